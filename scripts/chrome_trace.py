@@ -0,0 +1,199 @@
+"""
+Write the verify jobs of a run as a Chrome trace, one timeline of all jobs.
+
+The jobs are read from the telemetry records verify writes next to the job
+bitcode (<job>.stats.json) or from --stats-log files. Each record holds when
+the job started and ended; jobs are laid out on worker lanes, each job on
+the first lane free when it started, so that the number of busy lanes is the
+number of jobs running at once. Inside a job, the phases SeaHorn reports the
+time of (metrics.yaml) are drawn one after the other in pipeline order at the
+end of the job, since SeaHorn reports their durations but not their start.
+A counter tracks the jobs running at any time.
+
+The run is given by --run-id, the SEA_RUN_ID of the jobs. By default it is
+the run of the job that ended last or, for jobs without a run id, the jobs
+that ran without a pause of more than --gap seconds before it. Open the
+trace in chrome://tracing or https://ui.perfetto.dev.
+"""
+import argparse
+import glob
+import json
+import os
+import sys
+
+STATS_SUFFIX = '.stats.json'
+SEAHORN_STAT = 'seahorn_total'
+# phases of the SeaHorn pipeline in the order they run, each with the
+# phases it contains
+PHASES = (('Control dependence analysis', ()),
+          ('Thinned Gate SSA transformation', ()),
+          ('BMC', ('opsem.assert', 'opsem.simplify', 'BMC.solve')))
+US = 1e6
+
+
+def read_records(build_dir, stats_logs):
+    records = []
+    for stats_log in stats_logs:
+        with open(stats_log, 'r') as f:
+            records.extend(json.loads(line) for line in f if line.strip())
+    if not stats_logs:
+        stats_files = glob.glob(os.path.join(build_dir, '**',
+                                             '*' + STATS_SUFFIX),
+                                recursive=True)
+        for stats_file in stats_files:
+            try:
+                with open(stats_file, 'r') as f:
+                    records.append(json.load(f))
+            except (OSError, ValueError):
+                continue
+    return [r for r in records
+            if r.get('start') is not None and r.get('end') is not None]
+
+
+def select_run(records, run_id, gap):
+    """Records of run RUN_ID, or of the last run"""
+    if not records:
+        return []
+    if run_id is None:
+        run_id = max(records, key=lambda r: r['end']).get('run_id')
+    if run_id is not None:
+        return [r for r in records if r.get('run_id') == run_id]
+    records = sorted((r for r in records if r.get('run_id') is None),
+                     key=lambda r: r['start'])
+    ends = []
+    for r in records:
+        ends.append(max(ends[-1], r['end']) if ends else r['end'])
+    # the run starts after the last pause of every worker
+    first = 0
+    for i in range(1, len(records)):
+        if ends[i - 1] + gap < records[i]['start']:
+            first = i
+    return records[first:]
+
+
+def assign_lanes(records):
+    """Lane of every record, the first one free when it started"""
+    lanes = []
+    lane_of = []
+    for r in records:
+        for lane, end in enumerate(lanes):
+            if end <= r['start']:
+                lanes[lane] = r['end']
+                break
+        else:
+            lane = len(lanes)
+            lanes.append(r['end'])
+        lane_of.append(lane)
+    return lane_of, len(lanes)
+
+
+def number(value):
+    try:
+        return float(value)
+    except (TypeError, ValueError):
+        return None
+
+
+def phase_events(r, lane, t0):
+    """Slices of the SeaHorn phases of record R, drawn at the end of the job"""
+    events = []
+    end = (r['end'] - t0) * US
+    total = number(r.get(SEAHORN_STAT))
+    durations = [(name, number(r.get(name)) or 0.0, inner)
+                 for name, inner in PHASES]
+    span = sum(d for _, d, _ in durations)
+    if total is not None:
+        span = max(span, total)
+    span = min(span, r['end'] - r['start'])
+    ts = end - span * US
+    if total is not None:
+        events.append({'name': 'seahorn', 'cat': 'phase', 'ph': 'X',
+                       'pid': 1, 'tid': lane, 'ts': ts, 'dur': span * US})
+    for name, secs, inner in durations:
+        if secs <= 0:
+            continue
+        dur = min(secs * US, end - ts)
+        events.append({'name': name, 'cat': 'phase', 'ph': 'X', 'pid': 1,
+                       'tid': lane, 'ts': ts, 'dur': dur,
+                       'args': {'seconds': secs}})
+        inner_ts = ts
+        for inner_name in inner:
+            inner_secs = number(r.get(inner_name)) or 0.0
+            if inner_secs <= 0:
+                continue
+            inner_dur = min(inner_secs * US, ts + dur - inner_ts)
+            events.append({'name': inner_name, 'cat': 'phase', 'ph': 'X',
+                           'pid': 1, 'tid': lane, 'ts': inner_ts,
+                           'dur': inner_dur, 'args': {'seconds': inner_secs}})
+            inner_ts += inner_dur
+        ts += dur
+    return events
+
+
+def trace_events(records):
+    records = sorted(records, key=lambda r: (r['start'], r['end']))
+    lane_of, lanes = assign_lanes(records)
+    t0 = records[0]['start']
+    run_id = records[0].get('run_id')
+    events = [{'name': 'process_name', 'ph': 'M', 'pid': 1,
+               'args': {'name': 'verify run {}'.format(run_id)
+                        if run_id else 'verify run'}}]
+    for lane in range(lanes):
+        events.append({'name': 'thread_name', 'ph': 'M', 'pid': 1,
+                       'tid': lane, 'args': {'name': 'worker {}'.format(lane)}})
+    changes = []
+    for r, lane in zip(records, lane_of):
+        mode = r.get('mode')
+        name = r['job_name'] + ('.' + mode if mode else '')
+        args = dict((k, r.get(k)) for k in ('verdict', 'status', 'expect',
+                                            'cached', 'max_rss_mb', 'pid',
+                                            'input'))
+        events.append({'name': name, 'cat': 'job', 'ph': 'X', 'pid': 1,
+                       'tid': lane, 'ts': (r['start'] - t0) * US,
+                       'dur': (r['end'] - r['start']) * US, 'args': args})
+        events.extend(phase_events(r, lane, t0))
+        changes.extend([(r['start'], 1), (r['end'], -1)])
+    running = 0
+    for t, change in sorted(changes):
+        running += change
+        events.append({'name': 'jobs running', 'ph': 'C', 'pid': 1,
+                       'ts': (t - t0) * US, 'args': {'jobs': running}})
+    return events, lanes
+
+
+def main(argv):
+    argp = argparse.ArgumentParser(
+        description=__doc__.strip().splitlines()[0])
+    argp.add_argument('--build-dir', default=os.getcwd())
+    argp.add_argument('--stats-log', action='append', default=[],
+                      help='Read the records of a verify --stats-log file '
+                      'instead of the build directory, may be repeated')
+    argp.add_argument('--run-id', default=None,
+                      help='SEA_RUN_ID of the run, the last run by default')
+    argp.add_argument('--gap', type=float, default=60, metavar='SECS',
+                      help='Pause between the jobs of one run without run '
+                      'ids')
+    argp.add_argument('-o', '--output', default='verify-trace.json',
+                      help='Chrome trace file written')
+    args = argp.parse_args(argv)
+
+    records = select_run(read_records(args.build_dir, args.stats_log),
+                         args.run_id, args.gap)
+    if not records:
+        print('No verify runs with start and end times found')
+        return 1
+    events, lanes = trace_events(records)
+    with open(args.output, 'w') as f:
+        json.dump({'traceEvents': events, 'displayTimeUnit': 'ms'}, f)
+    start = min(r['start'] for r in records)
+    end = max(r['end'] for r in records)
+    busy = sum(r['end'] - r['start'] for r in records)
+    print('{} jobs on {} workers in {:.1f}s, workers busy {:.0f}% of the '
+          'time, trace in {}'.format(len(records), lanes, end - start,
+                                     100 * busy / max((end - start) * lanes,
+                                                      1e-9), args.output))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -4,6 +4,7 @@ import csv
 import argparse
 import yaml
 import glob
+import json
 from collections import defaultdict
 
 METRICS_FILE = "metrics.yaml"
@@ -38,6 +39,20 @@ def read_brunchstat_from_log(log_file_name):
     return data
 
 
+def read_brunchstat_from_json(stats_file_name):
+    """Read the JSON lines written by verify --stats-log"""
+    data = list()
+    with open(stats_file_name, 'r') as stats_file:
+        for line in stats_file:
+            if not line.strip():
+                continue
+            record = json.loads(line)
+            job_data = defaultdict(lambda: 'n/a')
+            job_data.update({k: v for k, v in record.items() if v is not None})
+            data.append(job_data)
+    return data
+
+
 def read_symbiotic_bruchstat_from_log(log_file_name, xml_file_dir, time_out):
     log_file = open(log_file_name, 'r')
     line = log_file.readline()
@@ -119,9 +134,13 @@ def write_brunchstat_into_csv(data, out_file):
 if __name__ == "__main__":
     parser = argparse.ArgumentParser(
         description='in and out files')
-    parser.add_argument('logfile', type=str, help=".log file to read from")
+    parser.add_argument('logfile', type=str,
+                        help=".log file or verify --stats-log file to read from")
     parser.add_argument('--outfile', '-o', type=str,
                         default="brunch_stat.csv", help="ouput csv filename")
     args = parser.parse_args()
-    data = read_brunchstat_from_log(args.logfile)
+    if args.logfile.endswith('.jsonl'):
+        data = read_brunchstat_from_json(args.logfile)
+    else:
+        data = read_brunchstat_from_log(args.logfile)
     write_brunchstat_into_csv(data, args.outfile)
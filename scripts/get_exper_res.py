@@ -6,6 +6,7 @@ import glob
 import subprocess
 import argparse
 from get_exper_brunch_stat import *
+import results_db
 
 BUILDABSPATH = os.path.abspath('../exper/')
 DATAABSPATH = os.path.abspath('../') + "/data"
@@ -41,7 +42,7 @@ def make_new_cmake_conf():
     return f'cmake -DSEA_LINK=llvm-link-10 -DCMAKE_C_COMPILER=clang-10\
     -DCMAKE_CXX_COMPILER=clang++-10 -DSEA_ENABLE_KLEE={use_klee} {smack_args}\
     -DSEA_WITH_BLEEDING_EDGE={use_bleeding_edge} -DSEA_ENABLE_SYMBIOTIC={use_symbiotic}\
-    -DSEAHORN_ROOT={SEAHORN_ROOT} ../ -GNinja'
+    -DSEAHORN_ROOT={SEAHORN_ROOT} -DSEA_RESULTS_DB={results_db.DEFAULT_DB} ../ -GNinja'
 
 
 def read_data_from_xml(res_data):
@@ -69,12 +70,15 @@ def write_data_into_csv(file_name, res_data):
             csvwriter.writerow(row)
 
 
-def collect_res_from_ctest(file_name):
+def collect_res_from_ctest(file_name, engine=None, config=''):
     res_data = []
     read_data_from_xml(res_data)
     write_data_into_csv(
         "{dir}/{file}".format(dir="../data", file=file_name), res_data)
     print("Done, find result csv file at: %s" % file_name)
+    # SeaHorn jobs are recorded by verify itself
+    if engine:
+        results_db.record_rows(results_db.ctest_rows(engine, config, res_data))
 
 
 def extra_to_filename(extra, suffix='csv'):
@@ -129,6 +133,8 @@ def collect_stat_from_ctest_log(outfile):
             test_tmpdir, latest_log), BUILDABSPATH, args.timeout)
         outpath = os.path.join(DATAABSPATH, outfile)
         write_symbiotic_bruchstat_into_csv(data, outpath)
+        results_db.record_rows(results_db.ctest_rows(
+            'symbiotic', '', [(k, *v) for k, v in data.items()]))
 
 
 def run_ctest_for_klee():
@@ -146,7 +152,7 @@ def run_ctest_for_klee():
         stdin=subprocess.PIPE,
         stdout=get_output_level())
     _ = process.communicate(cddir.encode())
-    collect_res_from_ctest(FILE_DICT["klee"])
+    collect_res_from_ctest(FILE_DICT["klee"], 'klee')
 
 
 def run_ctest_for_smack():
@@ -165,8 +171,9 @@ def run_ctest_for_smack():
         stdout=get_output_level())
     _ = process.communicate(cddir.encode())
     mem_split = 'mem_no_split' if args.mem_no_split else 'mem_split'
-    collect_res_from_ctest(extra_to_filename(
-        [str(args.precise), str(args.checks), mem_split]))
+    smack_conf = [str(args.precise), str(args.checks), mem_split]
+    collect_res_from_ctest(extra_to_filename(smack_conf), 'smack',
+                           ' '.join(smack_conf))
 
 
 def run_ctest_for_symbiotic():
@@ -188,6 +195,8 @@ def run_ctest_for_symbiotic():
 
 
 def main():
+    # every test run by ctest below is recorded under the same run id
+    results_db.start_run()
     os.makedirs(DATAABSPATH, exist_ok=True)
     os.makedirs(BUILDABSPATH, exist_ok=True)
     if args.seahorn:
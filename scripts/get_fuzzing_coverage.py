@@ -3,6 +3,9 @@ import sys
 import argparse
 import subprocess
 import shutil
+import time
+
+import results_db
 
 VCC_ROOT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
 DEFAULT_BUILD_DIR = os.path.join(VCC_ROOT_DIR, 'build')
@@ -27,6 +30,7 @@ def _generate_coverage_data(fuzz_binary, out_dir):
     '-detect_leaks=0'
   ]
   # subprocess.check_call(fuzz_cmd)
+  start = time.monotonic()
   fuzz_process = subprocess.Popen(fuzz_cmd, shell=False,
                              encoding='utf-8',
                              errors='ignore',
@@ -35,9 +39,13 @@ def _generate_coverage_data(fuzz_binary, out_dir):
                              env={'ASAN_OPTIONS':'detect_leaks=0'})
   rcode = fuzz_process.wait()
   fuzz_process.stdout.close()
+  row = {'engine': 'fuzz', 'job': os.path.basename(job_dir),
+         'timing': time.monotonic() - start}
   if rcode != 0:
     print("{} went wrong...".format(fuzz_binary))
-    return
+    # a corpus input that crashes the harness is a counterexample
+    row.update({'verdict': 'sat', 'status': 'failed'})
+    return row
 
   # llvm-profdata-10 merge -sparse default.profraw -o default.profdata
   merge_cmd = [
@@ -73,7 +81,22 @@ def _generate_coverage_data(fuzz_binary, out_dir):
   if export_res != 0:
     print("llvm-cov failed, look in {}".format(trace_file_name))
   trace_file.close()
-  return
+  row.update({'status': 'passed', 'metrics': _read_coverage(trace_file_name)})
+  return row
+
+
+def _read_coverage(trace_file_name):
+  """Lines and functions found and hit in an lcov trace file"""
+  coverage = dict.fromkeys(['lines_found', 'lines_hit',
+                            'functions_found', 'functions_hit'], 0)
+  keys = {'LF': 'lines_found', 'LH': 'lines_hit',
+          'FNF': 'functions_found', 'FNH': 'functions_hit'}
+  with open(trace_file_name, 'r') as trace_file:
+    for line in trace_file:
+      key, _, value = line.strip().partition(':')
+      if key in keys and value.isdigit():
+        coverage[keys[key]] += int(value)
+  return coverage
 
 
 def main(args):
@@ -85,19 +108,24 @@ def main(args):
     print("No llvm-cov-10 or llvm-profdata available!")
     return
   print("Collecting fuzzing coverage in {}".format(build_dir))
+  results_db.start_run()
   data_dir = os.path.join(VCC_ROOT_DIR, 'data')
   os.makedirs(data_dir, exist_ok=True)
   coverage_dir = os.path.join(data_dir, COV_DIRNAME)
   os.makedirs(coverage_dir, exist_ok=True)
 
   job_dirs = sorted(next(os.walk(os.path.join(build_dir, 'seahorn', 'jobs')))[1])
+  rows = []
   for job in job_dirs:
     job_dir = os.path.join(build_dir, 'seahorn', 'jobs', job)
     fuzz_binary = "{}_fuzz".format(job)
     fuzz_binary = os.path.join(job_dir, fuzz_binary)
     if (not os.path.exists(fuzz_binary)) or (not os.path.isfile(fuzz_binary)):
       continue
-    _generate_coverage_data(fuzz_binary, coverage_dir)
+    row = _generate_coverage_data(fuzz_binary, coverage_dir)
+    if row is not None:
+      rows.append(row)
+  results_db.record_rows(rows)
 
   _, _, trace_files = next(os.walk(coverage_dir))
   lcov_cmd = [LCOV]
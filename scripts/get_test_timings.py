@@ -0,0 +1,124 @@
+"""
+Collect execution times of the tests of a build directory into a
+"Name,Timing,Result" csv file, the format written by get_exper_res.py,
+extended by a MaxRSS column with the peak memory in MB reported by verify.
+
+Timings are read from the Test.xml files of dashboard runs
+(ctest -D ExperimentalTest) and from CTestCostData.txt, which every ctest
+run updates. Peak memory is read from the BRUNCH_STAT max_rss_mb lines of
+the ctest logs. Tests missing from the build directory keep the values
+already recorded in the output file.
+"""
+import argparse
+import csv
+import glob
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+COST_DATA = os.path.join('Testing', 'Temporary', 'CTestCostData.txt')
+TEST_LOGS = os.path.join('Testing', 'Temporary', 'LastTest*.log')
+MAX_RSS_RE = re.compile(r'^BRUNCH_STAT max_rss_mb ([0-9]+)')
+
+
+def read_timings_from_csv(csv_file, timings, memory):
+    if not os.path.isfile(csv_file):
+        return
+    with open(csv_file, 'r', newline='') as f:
+        for row in csv.DictReader(f):
+            try:
+                timings[row['Name']] = [float(row['Timing']), row['Result']]
+            except (KeyError, TypeError, ValueError):
+                continue
+            if row.get('MaxRSS'):
+                memory[row['Name']] = int(row['MaxRSS'])
+
+
+def read_timings_from_xml(build_dir, timings):
+    xml_files = glob.glob(os.path.join(build_dir, 'Testing', '**', 'Test.xml'),
+                          recursive=True)
+    for xml_file in sorted(xml_files, key=os.path.getmtime):
+        try:
+            root = ET.parse(xml_file).getroot()
+        except ET.ParseError:
+            continue
+        testlist = root.find('Testing')
+        if testlist is None:
+            continue
+        for test in testlist.findall('Test'):
+            results = test.find('Results')
+            if results is None:
+                continue
+            for name_measure_tag in results.findall('NamedMeasurement'):
+                if name_measure_tag.attrib['name'] == 'Execution Time':
+                    timings[test.find('Name').text] = [
+                        float(name_measure_tag.find('Value').text),
+                        test.get('Status')]
+
+
+def read_timings_from_cost_data(build_dir, timings):
+    cost_file = os.path.join(build_dir, COST_DATA)
+    if not os.path.isfile(cost_file):
+        return
+    with open(cost_file, 'r') as f:
+        lines = f.read().splitlines()
+    failed = set()
+    if '---' in lines:
+        idx = lines.index('---')
+        failed = set(lines[idx + 1:])
+        lines = lines[:idx]
+    for line in lines:
+        parts = line.split()
+        if len(parts) != 3:
+            continue
+        name, _, cost = parts
+        timings[name] = [float(cost), 'failed' if name in failed else 'passed']
+
+
+def read_memory_from_logs(build_dir, memory):
+    log_files = glob.glob(os.path.join(build_dir, TEST_LOGS))
+    for log_file in sorted(log_files, key=os.path.getmtime):
+        cur_test = None
+        with open(log_file, 'r', errors='ignore') as f:
+            for line in f:
+                new_test = re.search("Test: ", line)
+                if new_test:
+                    cur_test = line[new_test.end():].strip()
+                    continue
+                m = MAX_RSS_RE.match(line)
+                if m and cur_test is not None:
+                    memory[cur_test] = int(m.group(1))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Collect historical test timings of a build directory')
+    parser.add_argument('--build-dir', default=os.getcwd())
+    parser.add_argument('-o', '--output', required=True,
+                        help='Output csv file, updated in place')
+    args = parser.parse_args()
+
+    timings = dict()
+    memory = dict()
+    read_timings_from_csv(args.output, timings, memory)
+    read_timings_from_xml(args.build_dir, timings)
+    read_timings_from_cost_data(args.build_dir, timings)
+    read_memory_from_logs(args.build_dir, memory)
+    if not timings:
+        return 0
+
+    tmp_file = args.output + '.tmp'
+    with open(tmp_file, 'w', newline='') as csvfile:
+        csvwriter = csv.writer(csvfile)
+        csvwriter.writerow(["Name", "Timing", "Result", "MaxRSS"])
+        for name in sorted(timings):
+            timing, res = timings[name]
+            csvwriter.writerow([name, '{:.3f}'.format(timing), res,
+                                memory.get(name, '')])
+    os.replace(tmp_file, args.output)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,280 @@
+"""
+Compare the last test run of a build directory against baseline timings.
+
+The baseline is a "Name,Timing,Result" csv file such as res/seahorn.csv,
+optionally with bmc_circuit_size and bmc_dag_size columns. The run is read
+from the telemetry records verify writes next to the job bitcode
+(<job>.stats.json) and, for tests without one, from the ctest timings of the
+newest Test.xml (ctest -T Test). Only the last run counts: the tests of that
+Test.xml and the records of the run chrome_trace.py would draw, so that the
+records of jobs not rerun since do not pass for the run. Verdicts served
+from the result cache say nothing about the time of a job and are skipped.
+
+The time of a job is noisy. With --history-db, the results database of
+earlier runs, the time of a test is compared with the median of its last
+--history-runs passing runs under the same configuration, and it regresses
+when it exceeds the median by more than --noise-k robust standard
+deviations (1.4826 times the median absolute deviation), and by at least
+--time-min seconds. Tests with fewer than --min-history earlier runs fall
+back to the baseline: they regress when their time grows by more than the
+relative tolerance and by more than the absolute one. A test also regresses
+when its circuit or DAG size, which do not vary between runs, grows by more
+than the size tolerance. Regressions are listed worst first and make the
+check fail.
+"""
+import argparse
+import csv
+import datetime
+import glob
+import os
+import sqlite3
+import sys
+import xml.etree.ElementTree as ET
+
+from chrome_trace import read_records, select_run
+from get_test_timings import read_timings_from_xml
+
+SIZES = ('bmc_circuit_size', 'bmc_dag_size')
+# stats of a telemetry record for each column of the baseline
+STATS = {'Timing': 'time', 'bmc_circuit_size': 'bmc.circ_sz',
+         'bmc_dag_size': 'bmc.dag_sz'}
+TEST_SUFFIX = {'sat': '_sat_test', 'unsat': '_unsat_test'}
+# scales the median absolute deviation to the standard deviation of a
+# normal distribution
+MAD_SCALE = 1.4826
+
+HISTORY = """
+SELECT job, verdict, config, timing FROM results
+WHERE engine = 'seahorn' AND status = 'passed' AND timing IS NOT NULL
+  AND time < ?
+ORDER BY time DESC
+"""
+
+
+def read_csv(csv_file):
+    with open(csv_file, 'r', newline='') as f:
+        return list(csv.DictReader(f))
+
+
+def number(value):
+    try:
+        return float(value)
+    except (TypeError, ValueError):
+        return None
+
+
+def read_baseline(baseline_files):
+    baseline = dict()
+    for baseline_file in baseline_files:
+        for row in read_csv(baseline_file):
+            if row.get('Result', 'passed') != 'passed':
+                continue
+            baseline[row['Name']] = dict(
+                (col, number(row.get(col))) for col in ('Timing',) + SIZES)
+    return baseline
+
+
+def last_tests(build_dir):
+    """Names of the tests of the newest Test.xml in BUILD_DIR, or None"""
+    xml_files = glob.glob(os.path.join(build_dir, 'Testing', '**', 'Test.xml'),
+                          recursive=True)
+    for xml_file in sorted(xml_files, key=os.path.getmtime, reverse=True):
+        try:
+            testlist = ET.parse(xml_file).getroot().find('Testing')
+        except ET.ParseError:
+            continue
+        if testlist is not None:
+            return set(test.find('Name').text
+                       for test in testlist.findall('Test'))
+    return None
+
+
+def read_run(build_dir, run_id=None, gap=60):
+    """Time and sizes of every test of the last run in BUILD_DIR, the job,
+    expected verdict and configuration of every test with a telemetry
+    record, and when the run started"""
+    run = dict()
+    jobs = dict()
+    records = select_run(read_records(build_dir, []), run_id, gap)
+    tests = last_tests(build_dir)
+    if tests is None:
+        tests = set(r['job_name'] + TEST_SUFFIX.get(r.get('expect'), '')
+                    for r in records)
+    timings = dict()
+    read_timings_from_xml(build_dir, timings)
+    for name, (timing, result) in timings.items():
+        if result == 'passed' and name in tests:
+            run[name] = {'Timing': timing}
+    for record in records:
+        if record.get('mode'):
+            continue
+        name = record['job_name'] + TEST_SUFFIX.get(record.get('expect'), '')
+        # a cached verdict says nothing about the time of the job
+        if record.get('cached') or record.get('status') != 'passed':
+            run.pop(name, None)
+            continue
+        if name not in tests:
+            continue
+        values = dict((col, number(record.get(stat)))
+                      for col, stat in STATS.items())
+        run.setdefault(name, dict()).update(
+            (col, v) for col, v in values.items() if v is not None)
+        jobs[name] = (record['job_name'], record.get('expect'),
+                      record.get('config') or '')
+    start = min((r['start'] for r in records), default=None)
+    return run, jobs, start
+
+
+def read_history(db_file, jobs, before, runs):
+    """Times of the last RUNS passing runs of every test of JOBS, a map from
+    test to its job, expected verdict and configuration, that ended before
+    BEFORE, in seconds since the epoch"""
+    history = dict()
+    if not db_file or not os.path.isfile(db_file):
+        return history
+    test_of = dict((key, name) for name, key in jobs.items())
+    if before is None:
+        before = datetime.datetime.utcnow().timestamp()
+    before = datetime.datetime.utcfromtimestamp(before).strftime(
+        '%Y-%m-%d %H:%M:%S')
+    try:
+        db = sqlite3.connect(db_file, timeout=60)
+        try:
+            for job, verdict, config, timing in db.execute(HISTORY,
+                                                           (before,)):
+                name = test_of.get((job, verdict, config))
+                if name is None:
+                    continue
+                times = history.setdefault(name, [])
+                if len(times) < runs:
+                    times.append(timing)
+        finally:
+            db.close()
+    except sqlite3.Error as e:
+        print('Cannot read the history in {}: {}'.format(db_file, e))
+    return history
+
+
+def median(values):
+    values = sorted(values)
+    mid = len(values) // 2
+    return values[mid] if len(values) % 2 else \
+        (values[mid - 1] + values[mid]) / 2
+
+
+def time_limit(old, times, args):
+    """Reference time and the largest time that is not a regression, from
+    the history TIMES if it is long enough, else from the baseline OLD"""
+    if len(times) >= args.min_history:
+        ref = median(times)
+        sigma = MAD_SCALE * median([abs(t - ref) for t in times])
+        return ref, ref + max(args.noise_k * sigma, args.time_min)
+    if old is None:
+        return None, None
+    return old, max(old * (1 + args.time_tolerance), old + args.time_min)
+
+
+def regressions(baseline, history, run, args):
+    """(name, metric, baseline, run, ratio) of every regression"""
+    found = []
+    for name, new in run.items():
+        old = baseline.get(name, dict())
+        for col in ('Timing',) + SIZES:
+            if new.get(col) is None:
+                continue
+            if col == 'Timing':
+                ref, limit = time_limit(old.get(col), history.get(name, []),
+                                        args)
+            else:
+                ref = old.get(col)
+                limit = None if ref is None else \
+                    ref * (1 + args.size_tolerance)
+            if limit is not None and new[col] > limit:
+                ratio = new[col] / ref if ref else float('inf')
+                found.append((name, col, ref, new[col], ratio))
+    return sorted(found, key=lambda r: -r[4])
+
+
+def update_baseline(baseline_file, run):
+    """Record the sizes of RUN in BASELINE_FILE, keeping its other columns"""
+    rows = read_csv(baseline_file)
+    with open(baseline_file, 'r', newline='') as f:
+        fields = next(csv.reader(f))
+    fields += [col for col in SIZES if col not in fields]
+    for row in rows:
+        for col in SIZES:
+            value = run.get(row['Name'], dict()).get(col)
+            if value is not None:
+                row[col] = '{:g}'.format(value)
+    tmp_file = baseline_file + '.tmp'
+    with open(tmp_file, 'w', newline='') as f:
+        writer = csv.DictWriter(f, fieldnames=fields)
+        writer.writeheader()
+        writer.writerows(rows)
+    os.replace(tmp_file, baseline_file)
+
+
+def main(argv):
+    argp = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    argp.add_argument('--build-dir', default=os.getcwd())
+    argp.add_argument('--baseline', action='append', required=True,
+                      help='Baseline csv file, may be repeated')
+    argp.add_argument('--run-id', default=None,
+                      help='SEA_RUN_ID of the run, the last run by default')
+    argp.add_argument('--gap', type=float, default=60, metavar='SECS',
+                      help='Pause between the jobs of one run without run '
+                      'ids')
+    argp.add_argument('--history-db', default=None, metavar='FILE',
+                      help='Results database with the times of earlier '
+                      'runs')
+    argp.add_argument('--history-runs', type=int, default=20,
+                      help='Earlier runs of a test its noise is measured on')
+    argp.add_argument('--min-history', type=int, default=5,
+                      help='Earlier runs needed to measure the noise of a '
+                      'test, the baseline is used otherwise')
+    argp.add_argument('--noise-k', type=float, default=3.0,
+                      help='Robust standard deviations of the history a '
+                      'time may exceed its median by')
+    argp.add_argument('--time-tolerance', type=float, default=0.25,
+                      help='Relative time increase tolerated without a '
+                      'history')
+    argp.add_argument('--time-min', type=float, default=2.0, metavar='SECS',
+                      help='Absolute time increase always tolerated')
+    argp.add_argument('--size-tolerance', type=float, default=0.05,
+                      help='Relative circuit and DAG size increase tolerated')
+    argp.add_argument('-o', '--output', default='perf-check.csv',
+                      help='Csv file with the regressions found')
+    argp.add_argument('--update-sizes', action='store_true', default=False,
+                      help='Record the sizes of the run in the first '
+                      'baseline file instead of checking')
+    args = argp.parse_args(argv)
+
+    run, jobs, start = read_run(args.build_dir, args.run_id, args.gap)
+    if args.update_sizes:
+        update_baseline(args.baseline[0], run)
+        return 0
+    baseline = read_baseline(args.baseline)
+    history = read_history(args.history_db, jobs, start, args.history_runs)
+    compared = [name for name in run
+                if name in baseline or
+                len(history.get(name, [])) >= args.min_history]
+    found = regressions(baseline, history, run, args)
+    with open(args.output, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(['Name', 'Metric', 'Baseline', 'Run', 'Ratio'])
+        for name, col, old, new, ratio in found:
+            writer.writerow([name, col, '{:g}'.format(old),
+                             '{:g}'.format(new), '{:.2f}'.format(ratio)])
+
+    print('Compared {} tests against the baseline'.format(len(compared)))
+    if not found:
+        return 0
+    print('{} regressions:'.format(len(found)))
+    for name, col, old, new, ratio in found:
+        print('  {:>7.2f}x {} {}: {:g} -> {:g}'.format(ratio, name, col, old,
+                                                       new))
+    return 1
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
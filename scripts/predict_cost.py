@@ -0,0 +1,253 @@
+"""
+Predict the verification time of every job from features of its bitcode.
+
+The features are counted in the textual IR of the linked job bitcode:
+instructions, loads, stores, memcpy and memmove calls, loops and the depth of
+their nest, calls of nondeterministic functions (nd_*, __VERIFIER_nondet_*)
+and allocation sites. A log-linear least squares model, log(time) against
+log(1 + feature), is fitted on the jobs with a historical time and predicts
+the time of all jobs. The predictions are written as a "Name,Timing,Result"
+csv file with result "predicted", which the build reads before the
+historical timings, so that jobs without a history are scheduled and timed
+out by their prediction. The fitted model is written as a JSON file.
+"""
+import argparse
+import csv
+import json
+import math
+import os
+import re
+import subprocess
+import sys
+
+from get_test_timings import read_timings_from_csv
+from tune_config import read_jobs
+
+FEATURES = ('instructions', 'loads', 'stores', 'memcpys', 'loops',
+            'loop_depth', 'nondet_calls', 'alloc_sites')
+DEFINE_RE = re.compile(r'^define .*\{$')
+LABEL_RE = re.compile(r'^([-\w.$]+|"[^"]+"):')
+INST_RE = re.compile(r'^\s+(?:%[-\w.$"]+ = )?(?:tail |notail |musttail )?'
+                     r'([a-z]+)\b(.*)$')
+BR_LABEL_RE = re.compile(r'label %([-\w.$]+|"[^"]+")')
+CALLEE_RE = re.compile(r'@("[^"]+"|[-\w$.]+)\(')
+MEMCPY_RE = re.compile(r'^(llvm\.)?mem(cpy|move)\b')
+NONDET_RE = re.compile(r'^(nd_|__VERIFIER_nondet_)')
+ALLOC_RE = re.compile(r'(malloc|calloc|realloc)|^aws_mem_(acquire|calloc)$')
+# weight of the ridge penalty, keeps the fit stable on few jobs
+RIDGE = 1e-3
+# the model needs a few more jobs than it has coefficients
+MIN_SAMPLES = len(FEATURES) + 3
+MIN_TIME = 0.01
+
+
+def loop_nest(back_edges):
+    """Depth of the deepest nest of loops, given as (header, latch) block
+    indices of their back edges"""
+    depth = 0
+    for header, latch in back_edges:
+        inner = sum(1 for h, l in back_edges if h <= header and latch <= l)
+        depth = max(depth, inner)
+    return depth
+
+
+def ir_features(ll_text):
+    """Features of the textual IR LL_TEXT"""
+    counts = dict.fromkeys(FEATURES, 0)
+    blocks = None
+    back_edges = []
+    for line in ll_text.splitlines():
+        if DEFINE_RE.match(line):
+            blocks = {'': 0}
+            back_edges = []
+            continue
+        if blocks is None:
+            continue
+        if line.startswith('}'):
+            counts['loops'] += len(back_edges)
+            counts['loop_depth'] = max(counts['loop_depth'],
+                                       loop_nest(back_edges))
+            blocks = None
+            continue
+        m = LABEL_RE.match(line)
+        if m:
+            blocks[m.group(1)] = len(blocks)
+            continue
+        m = INST_RE.match(line)
+        if not m:
+            continue
+        opcode, rest = m.groups()
+        if opcode == 'call' and 'void @llvm.dbg.' in rest:
+            continue
+        counts['instructions'] += 1
+        if opcode in ('load', 'store'):
+            counts[opcode + 's'] += 1
+        elif opcode == 'br':
+            # a branch to a block that comes earlier closes a loop
+            current = len(blocks) - 1
+            for target in BR_LABEL_RE.findall(rest):
+                if target in blocks and blocks[target] <= current:
+                    back_edges.append((blocks[target], current))
+        elif opcode in ('call', 'invoke'):
+            callee = CALLEE_RE.search(rest)
+            if callee is None:
+                continue
+            callee = callee.group(1).strip('"')
+            if MEMCPY_RE.match(callee):
+                counts['memcpys'] += 1
+            elif NONDET_RE.match(callee):
+                counts['nondet_calls'] += 1
+            elif ALLOC_RE.search(callee):
+                counts['alloc_sites'] += 1
+    return counts
+
+
+def read_features(features_file):
+    """Cached features of a previous run, by bitcode file"""
+    features = dict()
+    if not os.path.isfile(features_file):
+        return features
+    with open(features_file, 'r', newline='') as f:
+        for row in csv.DictReader(f):
+            try:
+                features[row['Bitcode']] = (
+                    row['Mtime'], dict((k, int(row[k])) for k in FEATURES))
+            except (KeyError, TypeError, ValueError):
+                continue
+    return features
+
+
+def job_features(bcs, llvm_dis, features_file):
+    """Features of every bitcode file of BCS, extracted again only for files
+    that changed since they were written to FEATURES_FILE"""
+    cached = read_features(features_file)
+    features = dict()
+    for bc in bcs:
+        if not os.path.isfile(bc):
+            continue
+        mtime = str(os.stat(bc).st_mtime_ns)
+        if bc in cached and cached[bc][0] == mtime:
+            features[bc] = cached[bc]
+            continue
+        try:
+            ll_text = subprocess.check_output([llvm_dis, '-o', '-', bc],
+                                              encoding='utf-8',
+                                              errors='ignore')
+        except (OSError, subprocess.CalledProcessError) as e:
+            print('Cannot disassemble {}: {}'.format(bc, e))
+            if isinstance(e, OSError):
+                # no other bitcode would do better
+                break
+            continue
+        features[bc] = (mtime, ir_features(ll_text))
+    with open(features_file, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(('Bitcode', 'Mtime') + FEATURES)
+        for bc, (mtime, counts) in sorted(features.items()):
+            writer.writerow([bc, mtime] + [counts[k] for k in FEATURES])
+    return dict((bc, counts) for bc, (_, counts) in features.items())
+
+
+def solve(a, b):
+    """Solution of the linear system A x = B by Gaussian elimination"""
+    n = len(b)
+    m = [list(row) + [v] for row, v in zip(a, b)]
+    for col in range(n):
+        pivot = max(range(col, n), key=lambda r: abs(m[r][col]))
+        m[col], m[pivot] = m[pivot], m[col]
+        if abs(m[col][col]) < 1e-12:
+            continue
+        for r in range(n):
+            if r != col:
+                f = m[r][col] / m[col][col]
+                m[r] = [x - f * y for x, y in zip(m[r], m[col])]
+    return [m[i][n] / m[i][i] if abs(m[i][i]) >= 1e-12 else 0.0
+            for i in range(n)]
+
+
+def inputs(counts, model):
+    """Standardized log features of COUNTS, with the intercept input"""
+    return [1.0] + [(math.log1p(counts[k]) - mu) / sd
+                    for k, mu, sd in zip(FEATURES, model['mean'],
+                                         model['scale'])]
+
+
+def fit(samples):
+    """Ridge regression of log time on the log features of SAMPLES, a list
+    of (features, time)"""
+    logs = [[math.log1p(counts[k]) for k in FEATURES] for counts, _ in samples]
+    mean = [sum(col) / len(logs) for col in zip(*logs)]
+    scale = [math.sqrt(sum((v - mu) ** 2 for v in col) / len(logs)) or 1.0
+             for col, mu in zip(zip(*logs), mean)]
+    model = {'features': list(FEATURES), 'mean': mean, 'scale': scale}
+    xs = [inputs(counts, model) for counts, _ in samples]
+    ys = [math.log(max(secs, MIN_TIME)) for _, secs in samples]
+    n = len(FEATURES) + 1
+    a = [[sum(x[i] * x[j] for x in xs) + (RIDGE * len(xs) if i == j > 0
+                                          else 0.0)
+          for j in range(n)] for i in range(n)]
+    b = [sum(x[i] * y for x, y in zip(xs, ys)) for i in range(n)]
+    model['weights'] = solve(a, b)
+    predicted = [predict_log(model, counts) for counts, _ in samples]
+    mean_y = sum(ys) / len(ys)
+    total = sum((y - mean_y) ** 2 for y in ys)
+    residual = sum((y - p) ** 2 for y, p in zip(ys, predicted))
+    model['samples'] = len(samples)
+    model['r2_log_time'] = 1 - residual / total if total else 0.0
+    return model
+
+
+def predict_log(model, counts):
+    return sum(w * x for w, x in zip(model['weights'],
+                                     inputs(counts, model)))
+
+
+def main(argv):
+    argp = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    argp.add_argument('jobs_file', help='Job list, e.g. verify-jobs.txt')
+    argp.add_argument('--timings', action='append', default=[],
+                      help='Csv file with historical timings, later files '
+                      'override earlier ones, may be repeated')
+    argp.add_argument('--llvm-dis', default='llvm-dis')
+    argp.add_argument('--features', default='job-features.csv',
+                      help='Csv file with the features of every job, also '
+                      'the cache of the features')
+    argp.add_argument('--model', default='cost-model.json',
+                      help='JSON file the fitted model is written to')
+    argp.add_argument('-o', '--output', default='seahorn-predicted.csv',
+                      help='Csv file with the predicted time of every job')
+    args = argp.parse_args(argv)
+
+    jobs = read_jobs(args.jobs_file, None)
+    features = job_features(sorted(set(bc for _, _, bc in jobs)),
+                            args.llvm_dis, args.features)
+    timings = dict()
+    for timings_file in args.timings:
+        read_timings_from_csv(timings_file, timings, dict())
+    samples = [(features[bc], timings[name][0]) for name, _, bc in jobs
+               if bc in features and name in timings and
+               timings[name][1] == 'passed']
+    if len(samples) < MIN_SAMPLES:
+        print('Only {} jobs with historical timings, no prediction'.format(
+            len(samples)))
+        for path in (args.model, args.output):
+            if os.path.isfile(path):
+                os.remove(path)
+        return 0
+    model = fit(samples)
+    with open(args.model, 'w') as f:
+        json.dump(model, f, indent=1)
+    with open(args.output, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(['Name', 'Timing', 'Result'])
+        for name, _, bc in jobs:
+            if bc in features:
+                secs = math.exp(predict_log(model, features[bc]))
+                writer.writerow([name, '{:.3f}'.format(secs), 'predicted'])
+    print('Predicted {} jobs from {} timings, R^2 of log time {:.2f}'.format(
+        len(jobs), len(samples), model['r2_log_time']))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
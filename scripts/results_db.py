@@ -0,0 +1,338 @@
+"""
+Record and query verification results of every engine in one SQLite file.
+
+Each row is one job verified by one engine with one configuration in one run,
+keyed on the run id, and holds the git revision of the benchmarks, the
+verdict, the test status, the time, the peak memory and the metrics of the
+run as a JSON object. verify records its runs when given a database, and
+the runners of the other engines record theirs; results from before can be
+imported from their csv files. Runs sharing the SEA_RUN_ID environment
+variable share a run id, and SEA_GIT_REV holds the revision. Runners set
+both once for all the processes they start. Plain ctest sets neither, so
+each of its tests is a run of its own unless SEA_RUN_ID is set for the
+invocation, e.g. SEA_RUN_ID=nightly-1 ctest.
+
+  results_db.py slowest --since 'start of month' --verdict unsat
+  results_db.py fastest-config 'hash_table_*'
+  results_db.py query 'SELECT engine, COUNT(*) FROM results GROUP BY engine'
+"""
+import argparse
+import csv
+import datetime
+import json
+import os
+import sqlite3
+import subprocess
+import sys
+import uuid
+
+VCC_ROOT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_DB = os.path.join(VCC_ROOT_DIR, 'data', 'results.db')
+METRICS_FILE = os.path.join(VCC_ROOT_DIR, 'scripts', 'metrics.yaml')
+RUN_ID_ENV = 'SEA_RUN_ID'
+GIT_REV_ENV = 'SEA_GIT_REV'
+# ctest test names of the engines, the job is what is left
+TEST_PREFIX = ('klee_', 'smack_', 'symbiotic_', 'fuzz_')
+TEST_SUFFIX = {'_unsat_test': 'unsat', '_sat_test': 'sat', '_test': None}
+
+SCHEMA = """
+CREATE TABLE IF NOT EXISTS results (
+  run_id TEXT NOT NULL,
+  time TEXT NOT NULL,
+  git_rev TEXT,
+  engine TEXT NOT NULL,
+  config TEXT NOT NULL,
+  job TEXT NOT NULL,
+  verdict TEXT,
+  status TEXT,
+  timing REAL,
+  max_rss_mb REAL,
+  metrics TEXT,
+  PRIMARY KEY (run_id, engine, config, job));
+CREATE INDEX IF NOT EXISTS results_job ON results (job, engine, config);
+CREATE INDEX IF NOT EXISTS results_time ON results (time);
+"""
+
+SLOWEST = """
+SELECT engine, job, config, verdict, timing, max_rss_mb, time, git_rev
+FROM (SELECT *, ROW_NUMBER() OVER (PARTITION BY engine
+                                   ORDER BY timing DESC) AS rank
+      FROM results WHERE status = 'passed' AND timing IS NOT NULL {where})
+WHERE rank <= ? ORDER BY engine, timing DESC
+"""
+
+# configurations by jobs passed, then by mean time. The mean is taken over
+# the latest result of every job so that often rerun configurations do not
+# count twice
+FASTEST_CONFIG = """
+SELECT engine, config, COUNT(*) AS jobs, AVG(timing) AS mean, MAX(timing) AS max
+FROM (SELECT engine, config, job, timing,
+             ROW_NUMBER() OVER (PARTITION BY engine, config, job
+                                ORDER BY time DESC) AS age
+      FROM results
+      WHERE job GLOB ? AND status = 'passed' AND timing IS NOT NULL {where})
+WHERE age = 1 GROUP BY engine, config ORDER BY jobs DESC, mean
+"""
+
+
+def connect(db_file=DEFAULT_DB):
+    dirname = os.path.dirname(os.path.abspath(db_file))
+    os.makedirs(dirname, exist_ok=True)
+    # concurrent tests record at once, writers wait for each other
+    db = sqlite3.connect(db_file, timeout=60)
+    db.execute('PRAGMA journal_mode=WAL')
+    db.executescript(SCHEMA)
+    return db
+
+
+def run_id():
+    """Id of the current run, shared with the processes it starts"""
+    if not os.environ.get(RUN_ID_ENV):
+        os.environ[RUN_ID_ENV] = '{}-{}'.format(
+            datetime.datetime.now().strftime('%Y%m%dT%H%M%S'),
+            uuid.uuid4().hex[:8])
+    return os.environ[RUN_ID_ENV]
+
+
+def start_run(src_dir=VCC_ROOT_DIR):
+    """Start a run owned by the caller: set the run id and the git revision
+    shared with the processes it starts"""
+    if GIT_REV_ENV not in os.environ:
+        os.environ[GIT_REV_ENV] = git_revision(src_dir) or ''
+    return run_id()
+
+
+def git_revision(src_dir=VCC_ROOT_DIR):
+    try:
+        out = subprocess.run(['git', '-C', src_dir, 'describe', '--always',
+                              '--dirty', '--abbrev=12'],
+                             stdout=subprocess.PIPE,
+                             stderr=subprocess.DEVNULL,
+                             encoding='utf-8', errors='ignore')
+    except OSError:
+        return None
+    return out.stdout.strip() or None
+
+
+def now():
+    """UTC time in the format of SQLite date functions"""
+    return datetime.datetime.utcnow().strftime('%Y-%m-%d %H:%M:%S')
+
+
+def record(db, rows, git_rev=None):
+    """Insert ROWS, dicts with the columns of the results table. The run id,
+    time and git revision default to those of the current run"""
+    if git_rev is None:
+        git_rev = os.environ.get(GIT_REV_ENV)
+    with db:
+        for row in rows:
+            metrics = row.get('metrics')
+            db.execute(
+                'INSERT OR REPLACE INTO results VALUES '
+                '(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)',
+                (row.get('run_id') or run_id(), row.get('time') or now(),
+                 row.get('git_rev', git_rev) or None, row['engine'],
+                 row.get('config') or '', row['job'], row.get('verdict'),
+                 row.get('status'), number(row.get('timing')),
+                 number(row.get('max_rss_mb')),
+                 json.dumps(metrics, sort_keys=True) if metrics else None))
+
+
+def record_rows(rows, db_file=DEFAULT_DB):
+    """Record ROWS into DB_FILE. Recording is best effort, the runners go on
+    if the database is not writable"""
+    try:
+        db = connect(db_file)
+        try:
+            record(db, rows)
+        finally:
+            db.close()
+    except (OSError, sqlite3.Error) as e:
+        print('Cannot record results into {}: {}'.format(db_file, e))
+        return False
+    return True
+
+
+def number(value):
+    try:
+        return float(value)
+    except (TypeError, ValueError):
+        return None
+
+
+def test_job(name):
+    """Job name and expected verdict of ctest test NAME"""
+    for prefix in TEST_PREFIX:
+        if name.startswith(prefix):
+            name = name[len(prefix):]
+            break
+    for suffix, expect in TEST_SUFFIX.items():
+        if name.endswith(suffix):
+            return name[:-len(suffix)], expect
+    return name, None
+
+
+def ctest_rows(engine, config, res_data):
+    """Rows of the [name, timing, status] results of a ctest run. Passing
+    tests of the other engines are those that found no counterexample"""
+    rows = []
+    for name, timing, status in res_data:
+        job, expect = test_job(name)
+        if status == 'passed' and expect is None:
+            expect = 'unsat'
+        rows.append({'engine': engine, 'config': config, 'job': job,
+                     'verdict': expect if status == 'passed' else None,
+                     'status': status, 'timing': timing})
+    return rows
+
+
+def csv_rows(csv_file, engine, config):
+    """Rows of a result csv: Name,Timing,Result files as under res/, the
+    aws-cbmc.csv of run_aws_res.py or a verify --stats-log file"""
+    if csv_file.endswith('.jsonl'):
+        import yaml
+        with open(METRICS_FILE, 'r') as f:
+            metrics_names = yaml.safe_load(f) or dict()
+        rows = []
+        with open(csv_file, 'r') as f:
+            for line in f:
+                if not line.strip():
+                    continue
+                record_ = json.loads(line)
+                if record_.get('cached'):
+                    continue
+                modes = ['--' + m for m in
+                         (record_.get('mode') or '').split('.') if m]
+                rows.append(stats_row(record_, ' '.join(modes + [config])
+                                      .strip(), metrics_names))
+        return rows
+    with open(csv_file, 'r', newline='') as f:
+        data = list(csv.DictReader(f))
+    if data and 'bench name' in data[0]:
+        return [cbmc_row(r) for r in data]
+    return ctest_rows(engine, config,
+                      [(r['Name'], r.get('Timing'), r.get('Result'))
+                       for r in data])
+
+
+def cbmc_row(data):
+    """Row of a line of aws-cbmc.csv, keyed by its column names"""
+    success = data.get('result (success/fail)') == 'success'
+    metrics = dict((k, v) for k, v in data.items()
+                   if k not in ('bench name', 'result (success/fail)') and v)
+    return {'engine': 'cbmc', 'job': data['bench name'],
+            'verdict': 'unsat' if success else None,
+            'status': 'passed' if success else 'failed',
+            'timing': data.get('total times (s)'), 'metrics': metrics}
+
+
+def stats_row(record_, config, metrics_names=None):
+    """Row of a verify telemetry record, with its stats named as in
+    METRICS_NAMES, a map from BRUNCH_STAT name to column name"""
+    metrics = dict()
+    for stat, value in record_.items():
+        if value is None or isinstance(value, (list, dict)):
+            continue
+        if metrics_names is not None:
+            if stat not in metrics_names:
+                continue
+            stat = metrics_names[stat]
+        metrics[stat] = value
+    return {'engine': 'seahorn', 'config': config, 'job': record_['job_name'],
+            'verdict': record_.get('verdict'),
+            'status': record_.get('status'), 'timing': record_.get('time'),
+            'max_rss_mb': record_.get('max_rss_mb'), 'metrics': metrics}
+
+
+def since_clause(since):
+    """SQL condition and parameters for results newer than SINCE, a date or
+    SQLite date modifiers such as 'start of month' or '-7 days'"""
+    if since is None:
+        return '', []
+    try:
+        datetime.date.fromisoformat(since[:10])
+        return ' AND time >= ?', [since]
+    except ValueError:
+        return " AND time >= datetime('now', ?)", [since]
+
+
+def print_table(cursor):
+    header = [d[0] for d in cursor.description]
+    rows = [['' if v is None else '{:.3f}'.format(v) if isinstance(v, float)
+             else str(v) for v in row] for row in cursor]
+    widths = [max([len(h)] + [len(r[i]) for r in rows])
+              for i, h in enumerate(header)]
+    for row in [header] + rows:
+        print('  '.join(v.ljust(w) for v, w in zip(row, widths)).rstrip())
+
+
+def main(argv):
+    argp = argparse.ArgumentParser(
+        description=__doc__.strip().splitlines()[0],
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog='\n'.join(__doc__.strip().splitlines()[1:]))
+    argp.add_argument('--db', default=DEFAULT_DB, help='Results database')
+    sub = argp.add_subparsers(dest='command', required=True)
+
+    query = sub.add_parser('query', help='Run an SQL query')
+    query.add_argument('sql')
+
+    slowest = sub.add_parser('slowest', help='Slowest passing jobs per engine')
+    slowest.add_argument('-n', type=int, default=20,
+                         help='Jobs shown per engine')
+    slowest.add_argument('--engine', default=None)
+    slowest.add_argument('--verdict', default=None,
+                         help='Only results with this verdict, e.g. unsat '
+                         'for proofs')
+    slowest.add_argument('--since', default=None,
+                         help="A date, or SQLite date modifiers such as "
+                         "'start of month'")
+
+    fastest = sub.add_parser('fastest-config',
+                             help='Configurations ranked by mean time on '
+                             'the jobs matching a glob')
+    fastest.add_argument('jobs', help="Glob of job names, e.g. 'hash_table_*'")
+    fastest.add_argument('--engine', default=None)
+    fastest.add_argument('--since', default=None)
+
+    imp = sub.add_parser('import', help='Import a result csv or a verify '
+                         '--stats-log file')
+    imp.add_argument('file')
+    imp.add_argument('--engine', default='seahorn',
+                     help='Engine of a Name,Timing,Result csv')
+    imp.add_argument('--config', default='')
+    imp.add_argument('--git-rev', default=None,
+                     help='Revision the results were produced at')
+    args = argp.parse_args(argv)
+
+    db = connect(args.db)
+    if args.command == 'import':
+        rows = csv_rows(args.file, args.engine, args.config)
+        record(db, rows, args.git_rev or '')
+        print('Imported {} results into {}'.format(len(rows), args.db))
+        return 0
+
+    if args.command == 'query':
+        cursor = db.execute(args.sql)
+        if cursor.description is not None:
+            print_table(cursor)
+        db.commit()
+        return 0
+
+    where, params = since_clause(args.since)
+    if args.engine:
+        where += ' AND engine = ?'
+        params.append(args.engine)
+    if args.command == 'slowest':
+        if args.verdict:
+            where += ' AND verdict = ?'
+            params.append(args.verdict)
+        print_table(db.execute(SLOWEST.format(where=where), params + [args.n]))
+    else:
+        print_table(db.execute(FASTEST_CONFIG.format(where=where),
+                               [args.jobs] + params))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -3,6 +3,7 @@ import re
 import csv
 import argparse
 import subprocess
+import results_db
 
 # parser = argparse.ArgumentParser()
 # parser.add_argument('-csv', type=str, help='give an output csv name', required=True)
@@ -153,11 +154,14 @@ def write_info_into_csv(table_lst):
             writer.writerow(out_data)
 
 def main():
+    results_db.start_run()
     table_list = []
     search_get_all_subdirse()
     run_benchs_cbmc()
     get_all_res_from_log_file(table_list)
     write_info_into_csv(table_list)
+    results_db.record_rows([results_db.cbmc_row(dict(zip(ATTRS, row)))
+                            for row in table_list])
 
 if __name__ == '__main__':
     main()
\ No newline at end of file
@@ -0,0 +1,106 @@
+"""
+Benchmark an SMT solver on a query corpus exported by verify --smt-corpus.
+
+Every query of the corpus is solved with the given solver command under a
+timeout. A query counts as solved when the solver answers within the timeout
+and agrees with the verdict recorded by SeaHorn; its score is then its
+solving time, and twice the timeout otherwise (PAR-2). The per-query results
+are written to a csv file and the totals printed.
+"""
+import argparse
+import concurrent.futures
+import csv
+import glob
+import json
+import os
+import shlex
+import subprocess
+import sys
+import time
+
+ANSWERS = ('sat', 'unsat', 'unknown')
+
+
+def solve(solver, query, timeout):
+    """Run SOLVER, a command line, on QUERY. Returns its answer, None on
+    timeout or error, and the time it took"""
+    start = time.monotonic()
+    try:
+        out = subprocess.run(solver + [query], stdout=subprocess.PIPE,
+                             stderr=subprocess.DEVNULL, encoding='utf-8',
+                             errors='ignore', timeout=timeout).stdout
+    except subprocess.TimeoutExpired:
+        return None, timeout
+    secs = time.monotonic() - start
+    answers = [l.strip() for l in out.splitlines() if l.strip() in ANSWERS]
+    return (answers[0] if answers else None), secs
+
+
+def load_meta(query):
+    try:
+        with open(os.path.splitext(query)[0] + '.json', 'r') as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return dict()
+
+
+def main(argv):
+    argp = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    argp.add_argument('corpus',
+                      help='Corpus directory of one SeaHorn version, '
+                      'e.g. <DIR>/seahorn-<version>')
+    argp.add_argument('--solver', required=True,
+                      help='Solver command line, the query is appended, '
+                      'e.g. "z3 -smt2" or "yices-smt2"')
+    argp.add_argument('--timeout', type=float, default=300,
+                      help='Timeout per query in seconds')
+    argp.add_argument('-j', '--jobs', type=int, default=1,
+                      help='Queries solved at once')
+    argp.add_argument('--results', default='par2.csv',
+                      help='Csv file with the result of every query')
+    args = argp.parse_args(argv)
+
+    queries = sorted(glob.glob(os.path.join(args.corpus, '*.smt2')))
+    if not queries:
+        print('No queries in {}'.format(args.corpus))
+        return 2
+    solver = shlex.split(args.solver)
+    with concurrent.futures.ThreadPoolExecutor(max(args.jobs, 1)) as pool:
+        runs = [pool.submit(solve, solver, q, args.timeout) for q in queries]
+        results = [r.result() for r in runs]
+
+    rows = []
+    solved = 0
+    wrong = 0
+    score = 0.0
+    for query, (answer, secs) in zip(queries, results):
+        expected = load_meta(query).get('verdict')
+        if answer in ('sat', 'unsat') and expected and answer != expected:
+            status = 'wrong'
+            wrong += 1
+        elif answer in ('sat', 'unsat'):
+            status = 'solved'
+            solved += 1
+        else:
+            status = 'timeout' if answer is None and secs >= args.timeout \
+                else 'unsolved'
+        par2 = secs if status == 'solved' else 2 * args.timeout
+        score += par2
+        rows.append([os.path.basename(query)[:-len('.smt2')], expected,
+                     answer, '{:.3f}'.format(secs), status,
+                     '{:.3f}'.format(par2)])
+    with open(args.results, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(['Name', 'Expected', 'Answer', 'Time', 'Status',
+                         'PAR2'])
+        writer.writerows(rows)
+
+    print('Solved {} of {} queries, {} wrong'.format(solved, len(queries),
+                                                      wrong))
+    print('PAR-2 {:.3f} s, {:.3f} s per query'.format(score,
+                                                     score / len(queries)))
+    return 1 if wrong else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,189 @@
+"""
+Search the verification options of each job for the fastest configuration.
+
+For every selected job of a job list, in the format of verify-jobs.txt, the
+job is first timed as configured. The options of the search space are then
+tried one at a time, each value on top of the best configuration so far,
+and a change is kept when the job still reports its expected verdict and
+gets faster. An option that makes the assumptions of a job vacuous proves
+it trivially, so for unsat jobs a faster change is kept only if verify --vac
+passes with it too. The search of a job stops when its time budget is
+spent. The best configuration is written to sea.tuned.yaml in the build
+directory of the job, where verify --tuned picks it up as the last yaml
+layer.
+"""
+import argparse
+import csv
+import os
+import re
+import signal
+import subprocess
+import sys
+import time
+
+import yaml
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SPACE_FILE = os.path.join(SCRIPT_DIR, 'tune_space.yaml')
+TUNED_CONFIG = 'sea.tuned.yaml'
+TUNE_RESULTS = 'tune-results.csv'
+# a change must save at least this fraction of the time to be kept, so that
+# noise does not pick options
+MIN_GAIN = 0.05
+
+
+def read_jobs(jobs_file, regex):
+    jobs = []
+    with open(jobs_file, 'r') as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) < 3 or fields[0].startswith('#'):
+                continue
+            if regex and not re.search(regex, fields[0]):
+                continue
+            jobs.append((fields[0], fields[1], fields[2]))
+    return jobs
+
+
+def run_verify(argv, timeout):
+    """Exit code of ARGV, or None if it did not exit within TIMEOUT seconds"""
+    process = subprocess.Popen(argv, stdout=subprocess.DEVNULL,
+                               stderr=subprocess.DEVNULL,
+                               start_new_session=True)
+    try:
+        return process.wait(timeout=max(timeout, 1))
+    except subprocess.TimeoutExpired:
+        os.killpg(process.pid, signal.SIGKILL)
+        process.wait()
+        return None
+
+
+def vacuity_passes(verify, flags, bc, config, timeout):
+    """Whether no assumption of BC is vacuous with the yaml layer CONFIG"""
+    argv = [verify] + flags + ['--no-tuned', '--no-result-cache', '--silent',
+                               '--vac', '--expect=unsat',
+                               '--config=' + config, bc]
+    return run_verify(argv, timeout) == 0
+
+
+def run_job(verify, flags, expect, bc, config, timeout):
+    """Time verify on BC with the yaml layer CONFIG. Returns the time, or
+    None if the job did not report EXPECT within TIMEOUT seconds"""
+    argv = [verify] + flags + ['--no-tuned', '--no-result-cache',
+                               '--pp-cache', '--silent']
+    if config:
+        argv.append('--config=' + config)
+    # options of CONFIG may change the preprocessed bitcode, so fill the
+    # preprocessed bitcode cache first, outside the timed run
+    subprocess.call(argv + ['--preprocess', bc], stdout=subprocess.DEVNULL,
+                    stderr=subprocess.DEVNULL)
+    argv.append('--expect=' + expect)
+    start = time.monotonic()
+    rcode = run_verify(argv + [bc], timeout)
+    secs = time.monotonic() - start
+    return secs if rcode == 0 else None
+
+
+def options_str(options):
+    return ' '.join('{}={}'.format(k, yaml.safe_dump(v).split('\n')[0])
+                    for k, v in options.items())
+
+
+def write_config(path, options, comment=None):
+    with open(path, 'w') as f:
+        if comment:
+            f.write('# {}\n'.format(comment))
+        yaml.safe_dump({'verify_options': options}, f,
+                       default_flow_style=False)
+
+
+def tune_job(args, space, name, expect, bc):
+    """Returns the baseline time, the best time and the best options of job
+    NAME, or None if it does not pass as configured"""
+    job_dir = os.path.abspath(os.path.join(os.path.dirname(bc), '..', '..'))
+    cand_file = os.path.join(job_dir, 'sea.tune.{}.yaml'.format(os.getpid()))
+    deadline = time.monotonic() + args.budget
+    try:
+        base = run_job(args.verify, args.verify_flags, expect, bc, None,
+                       args.budget)
+        if base is None:
+            print('{}: does not pass as configured, skipped'.format(name))
+            return None
+        best, best_opts = base, dict()
+        print('{}: {:.2f}s as configured'.format(name, base))
+        for opt, values in space.items():
+            for value in values:
+                if best_opts.get(opt) == value:
+                    continue
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    print('{}: budget spent'.format(name))
+                    return base, best, best_opts
+                cand = dict(best_opts)
+                cand[opt] = value
+                write_config(cand_file, cand)
+                # no need to wait for a candidate that cannot win
+                secs = run_job(args.verify, args.verify_flags, expect, bc,
+                               cand_file, min(remaining, best))
+                faster = secs is not None and secs < best * (1 - MIN_GAIN)
+                vacuous = faster and expect == 'unsat' and \
+                    not vacuity_passes(args.verify, args.verify_flags, bc,
+                                       cand_file, args.budget)
+                print('{}: {} {}{}'.format(
+                    name, options_str({opt: value}),
+                    'failed' if secs is None else '{:.2f}s'.format(secs),
+                    ', vacuous' if vacuous else ''))
+                if faster and not vacuous:
+                    best, best_opts = secs, cand
+        return base, best, best_opts
+    finally:
+        if os.path.isfile(cand_file):
+            os.remove(cand_file)
+
+
+def main(argv):
+    argp = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    argp.add_argument('jobs_file', help='Job list, e.g. verify-jobs.txt')
+    argp.add_argument('--match', default=None, metavar='REGEX',
+                      help='Tune only the jobs whose test name matches')
+    argp.add_argument('--verify', default='./verify',
+                      help='The verify script of the build directory')
+    argp.add_argument('--verify-flags', default='', type=str.split,
+                      help='Flags passed to every verify run')
+    argp.add_argument('--budget', type=float, default=1800, metavar='SECS',
+                      help='Time budget per job')
+    argp.add_argument('--space', default=SPACE_FILE,
+                      help='Options to search and their values')
+    argp.add_argument('--results', default=TUNE_RESULTS,
+                      help='Csv file with the outcome for every job')
+    args = argp.parse_args(argv)
+
+    with open(args.space, 'r') as f:
+        space = yaml.safe_load(f) or dict()
+    rows = []
+    for name, expect, bc in read_jobs(args.jobs_file, args.match):
+        res = tune_job(args, space, name, expect, bc)
+        if res is None:
+            continue
+        base, best, opts = res
+        tuned_file = os.path.join(os.path.dirname(bc), '..', '..',
+                                  TUNED_CONFIG)
+        if opts:
+            write_config(tuned_file, opts,
+                         'generated by tune_config.py: {:.2f}s -> {:.2f}s'
+                         .format(base, best))
+            print('{}: {:.2f}s -> {:.2f}s with {}'.format(
+                name, base, best, options_str(opts)))
+        elif os.path.isfile(tuned_file):
+            os.remove(tuned_file)
+        rows.append([name, '{:.3f}'.format(base), '{:.3f}'.format(best),
+                     options_str(opts)])
+    with open(args.results, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(['Name', 'Timing', 'TunedTiming', 'Options'])
+        writer.writerows(rows)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,292 @@
+"""
+Rerun only the seahorn jobs whose reachable code changed since the last
+recorded run.
+
+Every function of the linked job bitcode gets a content hash. The functions
+and globals reachable from main, together with the sea.yaml layers of the job,
+its tuned configuration and the VERIFY_FLAGS of the tests, make up the digest
+of a job. Jobs whose digest differs from the one recorded
+in the state file are passed to ctest; the state of the jobs that pass is
+recorded afterwards.
+"""
+import argparse
+import glob
+import hashlib
+import json
+import os
+import re
+import subprocess
+import sys
+
+STATE_FILE = 'verify-affected.json'
+JOBS_FILE = 'verify-jobs.txt'
+TUNED_CONFIG = 'sea.tuned.yaml'
+FAILED_LOG = os.path.join('Testing', 'Temporary', 'LastTestsFailed.log')
+TEST_SUFFIXES = ('_unsat_test', '_sat_test')
+
+DEFINE_RE = re.compile(r'^define .*@("[^"]+"|[-\w$.]+)\(.*?(!dbg (![0-9]+))?\s*\{$')
+DECLARE_RE = re.compile(r'^declare .*@("[^"]+"|[-\w$.]+)\(')
+GLOBAL_RE = re.compile(r'^@("[^"]+"|[-\w$.]+) = ')
+REF_RE = re.compile(r'@("[^"]+"|[-\w$.]+)')
+# metadata and attribute groups are numbered per module, so their numbers
+# change whenever any other function of the job changes. References to
+# attribute groups are replaced by the attributes of the group, and
+# references to metadata, e.g., !tbaa or !llvm.loop, by the metadata they
+# point to. Debug info only locates the code, so it is left out
+ATTR_RE = re.compile(r' #([0-9]+)')
+ATTR_GROUP_RE = re.compile(r'^attributes #([0-9]+) = \{ (.*) \}$')
+METADATA_RE = re.compile(r'!([0-9]+)')
+METADATA_DEF_RE = re.compile(r'^!([0-9]+) = (?:distinct )?(.*)$')
+DBG_RE = re.compile(r'!dbg ![0-9]+')
+DEBUG_INFO_PREFIX = '!DI'
+SUBPROGRAM_RE = re.compile(r'^(![0-9]+) = distinct !DISubprogram\(.*\bfile: (![0-9]+)')
+FILE_RE = re.compile(r'^(![0-9]+) = !DIFile\(filename: "([^"]*)", directory: "([^"]*)"')
+
+
+def _parse_module(ll_text):
+    """Returns a map from every function and global of LL_TEXT to its text,
+    a map from function to the source file it was compiled from, a map
+    from attribute group number to its attributes and a map from metadata
+    number to its definition"""
+    bodies = dict()
+    attrs = dict()
+    metadata = dict()
+    dbg = dict()
+    subprograms = dict()
+    files = dict()
+    cur = None
+    for line in ll_text.splitlines():
+        if cur is not None:
+            bodies[cur].append(line)
+            if line == '}':
+                cur = None
+            continue
+        m = DEFINE_RE.match(line)
+        if m:
+            cur = m.group(1)
+            bodies[cur] = [line]
+            if m.group(3):
+                dbg[cur] = m.group(3)
+            continue
+        m = DECLARE_RE.match(line) or GLOBAL_RE.match(line)
+        if m:
+            bodies[m.group(1)] = [line]
+            continue
+        m = SUBPROGRAM_RE.match(line)
+        if m:
+            subprograms[m.group(1)] = m.group(2)
+            continue
+        m = FILE_RE.match(line)
+        if m:
+            files[m.group(1)] = os.path.normpath(
+                os.path.join(m.group(3), m.group(2)))
+            continue
+        m = ATTR_GROUP_RE.match(line)
+        if m:
+            attrs[m.group(1)] = m.group(2)
+            continue
+        m = METADATA_DEF_RE.match(line)
+        if m:
+            metadata[m.group(1)] = m.group(2)
+    sources = dict()
+    for name, sp in dbg.items():
+        f = files.get(subprograms.get(sp))
+        if f is not None:
+            sources[name] = f
+    return ({k: '\n'.join(v) for k, v in bodies.items()}, sources, attrs,
+            metadata)
+
+
+def _reachable(bodies, root='main'):
+    seen = set()
+    todo = [root]
+    while todo:
+        name = todo.pop()
+        if name in seen or name not in bodies:
+            continue
+        seen.add(name)
+        # skip the symbol being defined
+        for ref in REF_RE.findall(bodies[name])[1:]:
+            if ref not in seen:
+                todo.append(ref)
+    return seen
+
+
+def _resolve(num, metadata, resolved, stack=()):
+    """Reference to metadata node NUM by the hash of its content, with the
+    nodes it references resolved in turn, memoized in RESOLVED. A reference
+    back to a node being resolved, e.g., of a loop id to itself, becomes
+    '!^'"""
+    if num in resolved:
+        return resolved[num]
+    if num in stack:
+        return '!^'
+    text = metadata.get(num, '?')
+    if text.startswith(DEBUG_INFO_PREFIX):
+        ref = DEBUG_INFO_PREFIX
+    else:
+        ref = '!' + _hash(METADATA_RE.sub(
+            lambda m: _resolve(m.group(1), metadata, resolved,
+                               stack + (num,)), text))
+    resolved[num] = ref
+    return ref
+
+
+def _normalize(text, attrs, metadata, resolved):
+    text = ATTR_RE.sub(lambda m: ' {' + attrs.get(m.group(1), '') + '}', text)
+    text = DBG_RE.sub('!dbg !', text)
+    return METADATA_RE.sub(
+        lambda m: _resolve(m.group(1), metadata, resolved), text)
+
+
+def _hash(text):
+    return hashlib.sha256(text.encode('utf-8')).hexdigest()[:16]
+
+
+def _origin(path, src_root):
+    if path is None:
+        return None
+    if src_root and path.startswith(src_root + os.sep):
+        return os.path.relpath(path, src_root)
+    return path
+
+
+def analyze_job(bc_file, llvm_dis, src_root, yaml_files, verify_flags=''):
+    ll_text = subprocess.check_output([llvm_dis, '-o', '-', bc_file],
+                                      encoding='utf-8', errors='ignore')
+    bodies, sources, attrs, metadata = _parse_module(ll_text)
+    resolved = dict()
+    functions = dict()
+    for name in sorted(_reachable(bodies)):
+        text = _normalize(bodies[name], attrs, metadata, resolved)
+        functions[name] = {'hash': _hash(text),
+                           'file': _origin(sources.get(name), src_root)}
+    h = hashlib.sha256()
+    for name, fn in functions.items():
+        h.update('{}:{}\n'.format(name, fn['hash']).encode('utf-8'))
+    for yaml_file in yaml_files:
+        if os.path.isfile(yaml_file):
+            with open(yaml_file, 'rb') as f:
+                h.update(f.read())
+    h.update(verify_flags.encode('utf-8'))
+    return {'digest': h.hexdigest()[:16], 'functions': functions}
+
+
+def find_jobs(jobs_file):
+    """Map job name to its final bitcode for every job with a seahorn test,
+    read from the job list CMake writes, verify-jobs.txt"""
+    jobs = dict()
+    with open(jobs_file, 'r') as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) < 3:
+                continue
+            for suffix in TEST_SUFFIXES:
+                if fields[0].endswith(suffix):
+                    jobs[fields[0][:-len(suffix)]] = fields[2]
+    return dict(sorted(jobs.items()))
+
+
+def load_state(state_file):
+    if not os.path.isfile(state_file):
+        return dict()
+    with open(state_file, 'r') as f:
+        return json.load(f)
+
+
+def save_state(state_file, state):
+    tmp_file = state_file + '.tmp'
+    with open(tmp_file, 'w') as f:
+        json.dump(state, f, indent=1, sort_keys=True)
+    os.replace(tmp_file, state_file)
+
+
+def changed_functions(old, new):
+    old_fns = old.get('functions', dict()) if old else dict()
+    return sorted(k for k, v in new['functions'].items()
+                  if old_fns.get(k, dict()).get('hash') != v['hash'])
+
+
+def failed_tests(build_dir):
+    log_file = os.path.join(build_dir, FAILED_LOG)
+    if not os.path.isfile(log_file):
+        return set()
+    with open(log_file, 'r') as f:
+        return {line.strip().split(':', 1)[-1] for line in f if line.strip()}
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Verify only the jobs whose reachable code changed')
+    parser.add_argument('--build-dir', default=os.getcwd())
+    parser.add_argument('--src-dir', default=None,
+                        help='Source root used to shorten recorded paths')
+    parser.add_argument('--llvm-dis', default='llvm-dis')
+    parser.add_argument('--verify-flags', default='',
+                        help='VERIFY_FLAGS of the tests, part of the '
+                        'configuration of every job')
+    parser.add_argument('--jobs', default=None,
+                        help='Job list (default: <build-dir>/{})'.format(
+                            JOBS_FILE))
+    parser.add_argument('--state', default=None,
+                        help='State file (default: <build-dir>/{})'.format(
+                            STATE_FILE))
+    parser.add_argument('--list', action='store_true', default=False,
+                        help='Only list affected jobs')
+    parser.add_argument('--record', action='store_true', default=False,
+                        help='Record the current state without verifying')
+    parser.add_argument('ctest_args', nargs=argparse.REMAINDER,
+                        help='Extra arguments for ctest')
+    args = parser.parse_args()
+
+    build_dir = os.path.abspath(args.build_dir)
+    src_root = os.path.abspath(args.src_dir) if args.src_dir else None
+    state_file = args.state or os.path.join(build_dir, STATE_FILE)
+    seahorn_dir = os.path.join(build_dir, 'seahorn')
+    base_yamls = sorted(glob.glob(os.path.join(seahorn_dir, 'sea*.yaml')))
+
+    state = load_state(state_file)
+    current = dict()
+    affected = []
+    jobs_file = args.jobs or os.path.join(build_dir, JOBS_FILE)
+    for name, bc_file in find_jobs(jobs_file).items():
+        job_dir = os.path.dirname(os.path.dirname(os.path.dirname(bc_file)))
+        yaml_files = base_yamls + [os.path.join(job_dir, 'sea.yaml'),
+                                   os.path.join(job_dir, TUNED_CONFIG)]
+        current[name] = analyze_job(bc_file, args.llvm_dis, src_root,
+                                    yaml_files, args.verify_flags)
+        old = state.get(name)
+        if old is None or old['digest'] != current[name]['digest']:
+            affected.append(name)
+            fns = changed_functions(old, current[name])
+            print('{}: {}'.format(name, ', '.join(fns) if fns and old
+                                  else 'not recorded' if old is None
+                                  else 'reachable set or configuration changed'))
+
+    print('{} of {} jobs affected'.format(len(affected), len(current)))
+    if args.list:
+        return 0
+    if args.record or not affected:
+        save_state(state_file, current)
+        return 0
+
+    tests = '|'.join(re.escape(name) for name in affected)
+    suffixes = '|'.join(TEST_SUFFIXES)
+    ctest_cmd = ['ctest', '-R', '^({})({})$'.format(tests, suffixes)]
+    ctest_cmd.extend(a for a in args.ctest_args if a != '--')
+    rcode = subprocess.call(ctest_cmd, cwd=build_dir)
+
+    # record every job that was not affected or whose tests passed
+    failed = failed_tests(build_dir) if rcode != 0 else set()
+    for name in affected:
+        if any(name + s in failed for s in TEST_SUFFIXES):
+            if name in state:
+                current[name] = state[name]
+            else:
+                del current[name]
+    save_state(state_file, current)
+    return rcode
+
+
+if __name__ == '__main__':
+    sys.exit(main())
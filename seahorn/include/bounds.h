@@ -40,4 +40,33 @@ size_t fuzz_max_array_list_item_size(void);
  */
 size_t fuzz_max_array_list_len(void);
 
+/**
+   Input variables that a job can be sharded on, see the SHARD option of
+   sea_job()
+ */
+enum sea_shard_var {
+  SEA_SHARD_NONE = 0,
+  SEA_SHARD_BUF_CAPACITY,
+  SEA_SHARD_TABLE_ENTRIES,
+  SEA_SHARD_LIST_LEN,
+};
+
+/**
+   Returns the lower bound of the current shard of VAR
+ */
+size_t sea_shard_lo(int var);
+
+/**
+   Returns the (inclusive) upper bound of the current shard of VAR
+ */
+size_t sea_shard_hi(int var);
+
+/**
+   Returns true if VAL lies in the current shard of VAR. Always true unless
+   the job is sharded on VAR
+ */
+static inline int sea_in_shard(int var, size_t val) {
+  return sea_shard_lo(var) <= val && val <= sea_shard_hi(var);
+}
+
 SEAHORN_EXTERN_C_END
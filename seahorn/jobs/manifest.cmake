@@ -0,0 +1,1034 @@
+# Verification jobs of aws-c-common, expanded by sea_job()
+
+sea_job(nospec_mask
+  HARNESS aws_nospec_mask_harness.c
+  LINK byte_buf.ir
+  ENGINES fuzz)
+
+sea_job(ptr_eq
+  HARNESS aws_ptr_eq_harness.c
+  LINK hash_table.ir
+  ENGINES klee smack symbiotic)
+
+sea_job(array_eq
+  HARNESS aws_array_eq_harness.c
+  LINK byte_buf.ir
+  ENGINES klee smack symbiotic
+  SMACK_FLAGS --strings)
+
+sea_job(array_eq_c_str
+  HARNESS aws_array_eq_c_str_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_eq_c_str_ignore_case
+  HARNESS aws_array_eq_c_str_ignore_case_harness.c
+  LINK byte_buf.ir
+  ENGINES klee smack symbiotic)
+
+sea_job(array_eq_ignore_case
+  HARNESS aws_array_eq_ignore_case_harness.c
+  LINK byte_buf.ir
+  ENGINES klee smack symbiotic)
+
+sea_job(add_size_checked
+  HARNESS aws_add_size_checked_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(add_size_saturating
+  HARNESS aws_add_size_saturating_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(mul_size_checked
+  HARNESS aws_mul_size_checked_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(mul_size_saturating
+  HARNESS aws_mul_size_saturating_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(is_power_of_two
+  HARNESS aws_is_power_of_two_harness.c
+  ENGINES klee smack symbiotic)
+
+sea_job(round_up_to_power_of_two
+  HARNESS aws_round_up_to_power_of_two_harness.c
+  ENGINES klee smack symbiotic)
+
+sea_job(array_list_back
+  HARNESS aws_array_list_back_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_capacity
+  HARNESS aws_array_list_capacity_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_clean_up
+  HARNESS aws_array_list_clean_up_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_clear
+  HARNESS aws_array_list_clear_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_comparator_string
+  HARNESS aws_array_list_comparator_string_harness.c
+  LINK array_list.ir string.ir
+  ENGINES klee fuzz smack symbiotic
+  SMACK_FLAGS --string)
+
+sea_job(array_list_copy
+  HARNESS aws_array_list_copy_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_ensure_capacity
+  HARNESS aws_array_list_ensure_capacity_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_erase
+  HARNESS aws_array_list_erase_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_front
+  HARNESS aws_array_list_front_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_get_at
+  HARNESS aws_array_list_get_at_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_get_at_ptr
+  HARNESS aws_array_list_get_at_ptr_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_init_dynamic
+  HARNESS aws_array_list_init_dynamic_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_init_static
+  HARNESS aws_array_list_init_static_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_length
+  HARNESS aws_array_list_length_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_pop_back
+  HARNESS aws_array_list_pop_back_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_pop_front
+  HARNESS aws_array_list_pop_front_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_pop_front_n
+  HARNESS aws_array_list_pop_front_n_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_push_back
+  HARNESS aws_array_list_push_back_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_push_front
+  HARNESS aws_array_list_push_front_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_set_at
+  HARNESS aws_array_list_set_at_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_shrink_to_fit
+  HARNESS aws_array_list_shrink_to_fit_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_sort
+  HARNESS aws_array_list_sort_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_swap
+  HARNESS aws_array_list_swap_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(array_list_swap_contents
+  HARNESS aws_array_list_swap_contents_harness.c
+  LINK array_list.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_advance
+  HARNESS aws_byte_buf_advance_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_append
+  HARNESS aws_byte_buf_append_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_append_dynamic
+  HARNESS aws_byte_buf_append_dynamic_harness.c
+  LINK byte_buf.ir
+  DEFINES __SEA_AWS_ALLOCATOR__
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_append_with_lookup
+  HARNESS aws_byte_buf_append_with_lookup_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+# Klee will get timeout on this test
+sea_job(byte_buf_cat
+  NO_YAML
+  HARNESS aws_byte_buf_cat_harness.c
+  LINK byte_buf.ir
+  ENGINES fuzz smack symbiotic)
+
+sea_job(byte_buf_clean_up
+  HARNESS aws_byte_buf_clean_up_harness.c
+  LINK byte_buf.ir
+  DEFINES __SEA_AWS_ALLOCATOR__
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_clean_up_secure
+  HARNESS aws_byte_buf_clean_up_secure_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK byte_buf.ir common.ir)
+
+sea_job(byte_buf_eq
+  HARNESS aws_byte_buf_eq_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic
+  SMACK_FLAGS --strings)
+
+sea_job(byte_buf_eq_c_str
+  HARNESS aws_byte_buf_eq_c_str_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_eq_c_str_ignore_case
+  HARNESS aws_byte_buf_eq_c_str_ignore_case_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_eq_ignore_case
+  HARNESS aws_byte_buf_eq_ignore_case_harness.c
+  LINK byte_buf.ir
+  ENGINES fuzz smack symbiotic)
+
+sea_job(byte_buf_from_array
+  HARNESS aws_byte_buf_from_array_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_from_c_str
+  HARNESS aws_byte_buf_from_c_str_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_from_empty_array
+  HARNESS aws_byte_buf_from_empty_array_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_init
+  HARNESS aws_byte_buf_init_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_init_copy
+  HARNESS aws_byte_buf_init_copy_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_init_copy_from_cursor
+  HARNESS aws_byte_buf_init_copy_from_cursor_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_reserve
+  HARNESS aws_byte_buf_reserve_harness.c
+  LINK byte_buf.ir
+  DEFINES MAX_BUFFER_SIZE=${MAX_BUFFER_SIZE}
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_reserve_relative
+  HARNESS aws_byte_buf_reserve_relative_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_reset
+  HARNESS aws_byte_buf_reset_harness.c
+  LINK common.ir byte_buf.ir
+  ENGINES klee fuzz smack symbiotic
+  SMACK_LINK byte_buf.ir common.ir)
+
+sea_job(byte_buf_secure_zero
+  HARNESS aws_byte_buf_secure_zero_harness.c
+  LINK byte_buf.ir common.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_write
+  HARNESS aws_byte_buf_write_harness.c
+  LINK byte_buf.ir
+  ENGINES klee smack symbiotic)
+
+sea_job(byte_buf_write_be16
+  HARNESS aws_byte_buf_write_be16_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_write_be32
+  HARNESS aws_byte_buf_write_be32_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_write_be64
+  HARNESS aws_byte_buf_write_be64_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_write_from_whole_buffer
+  HARNESS aws_byte_buf_write_from_whole_buffer_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_write_from_whole_cursor
+  HARNESS aws_byte_buf_write_from_whole_cursor_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_buf_write_from_whole_string
+  HARNESS aws_byte_buf_write_from_whole_string_harness.c
+  LINK string.ir byte_buf.ir
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK byte_buf.ir string.ir
+  SMACK_LINK byte_buf.ir string.ir
+  SYMBIOTIC_LINK byte_buf.ir string.ir)
+
+sea_job(byte_buf_write_u8
+  HARNESS aws_byte_buf_write_u8_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_advance
+  HARNESS aws_byte_cursor_advance_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_advance_nospec
+  HARNESS aws_byte_cursor_advance_nospec_harness.c
+  LINK byte_buf.ir
+  ENGINES fuzz)
+
+sea_job(byte_cursor_compare_lexical
+  HARNESS aws_byte_cursor_compare_lexical_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic
+  SMACK_FLAGS --strings)
+
+sea_job(byte_cursor_compare_lookup
+  HARNESS aws_byte_cursor_compare_lookup_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_eq
+  HARNESS aws_byte_cursor_eq_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic
+  SMACK_FLAGS --strings)
+
+sea_job(byte_cursor_eq_byte_buf
+  HARNESS aws_byte_cursor_eq_byte_buf_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic
+  SMACK_FLAGS --strings)
+
+sea_job(byte_cursor_eq_byte_buf_ignore_case
+  HARNESS aws_byte_cursor_eq_byte_buf_ignore_case_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_eq_c_str
+  HARNESS aws_byte_cursor_eq_c_str_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_eq_c_str_ignore_case
+  HARNESS aws_byte_cursor_eq_c_str_ignore_case_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_eq_ignore_case
+  HARNESS aws_byte_cursor_eq_ignore_case_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_from_array
+  HARNESS aws_byte_cursor_from_array_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_from_buf
+  HARNESS aws_byte_cursor_from_buf_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_from_c_str
+  HARNESS aws_byte_cursor_from_c_str_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_from_string
+  HARNESS aws_byte_cursor_from_string_harness.c
+  LINK byte_buf.ir string.ir
+  ENGINES klee fuzz symbiotic)
+
+sea_job(byte_cursor_left_trim_pred
+  HARNESS aws_byte_cursor_left_trim_pred_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_read
+  HARNESS aws_byte_cursor_read_harness.c
+  LINK byte_buf.ir
+  OVERRIDE byte_cursor_advance_nospec_override.ir
+  ENGINES fuzz)
+
+sea_job(byte_cursor_read_and_fill_buffer
+  HARNESS aws_byte_cursor_read_and_fill_buffer_harness.c
+  LINK byte_buf.ir
+  OVERRIDE byte_cursor_advance_nospec_override.ir
+  ENGINES fuzz)
+
+sea_job(byte_cursor_read_be16
+  HARNESS aws_byte_cursor_read_be16_harness.c
+  LINK byte_buf.ir
+  OVERRIDE byte_cursor_advance_nospec_override.ir
+  ENGINES fuzz)
+
+sea_job(byte_cursor_read_be32
+  HARNESS aws_byte_cursor_read_be32_harness.c
+  LINK byte_buf.ir
+  OVERRIDE byte_cursor_advance_nospec_override.ir
+  ENGINES fuzz)
+
+sea_job(byte_cursor_read_be64
+  HARNESS aws_byte_cursor_read_be64_harness.c
+  LINK byte_buf.ir
+  OVERRIDE byte_cursor_advance_nospec_override.ir
+  ENGINES fuzz)
+
+sea_job(byte_cursor_read_u8
+  HARNESS aws_byte_cursor_read_u8_harness.c
+  LINK byte_buf.ir
+  OVERRIDE byte_cursor_advance_nospec_override.ir
+  ENGINES fuzz)
+
+sea_job(byte_cursor_right_trim_pred
+  HARNESS aws_byte_cursor_right_trim_pred_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_satisfies_pred
+  HARNESS aws_byte_cursor_satisfies_pred_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(byte_cursor_trim_pred
+  HARNESS aws_byte_cursor_trim_pred_harness.c
+  LINK byte_buf.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(hash_ptr
+  HARNESS aws_hash_ptr_harness.c
+  LINK hash_table.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(hash_string
+  HARNESS aws_hash_string_harness.c
+  LINK string.ir hash_table.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(hash_array_ignore_case
+  HARNESS aws_hash_array_ignore_case_harness.c
+  LINK byte_buf.ir hash_table.ir
+  ENGINES klee smack symbiotic)
+
+sea_job(hash_byte_cursor_ptr
+  HARNESS aws_hash_byte_cursor_ptr_harness.c
+  LINK hash_table.ir byte_buf.ir
+  ENGINES klee fuzz smack symbiotic
+  SMACK_LINK byte_buf.ir hash_table.ir
+  SYMBIOTIC_LINK byte_buf.ir hash_table.ir)
+
+sea_job(hash_byte_cursor_ptr_ignore_case
+  HARNESS aws_hash_byte_cursor_ptr_ignore_case_harness.c
+  LINK byte_buf.ir hash_table.ir
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK hash_table.ir byte_buf.ir)
+
+sea_job(hash_c_string
+  HARNESS aws_hash_c_string_harness.c
+  LINK hash_table.ir
+  ENGINES klee smack symbiotic)
+
+sea_job(hash_callback_string_eq
+  HARNESS aws_hash_callback_string_eq_harness.c
+  LINK byte_buf.ir string.ir common.ir hash_table.ir
+  ENGINES klee fuzz smack symbiotic
+  SMACK_FLAGS --strings)
+
+sea_job(hash_callback_c_str_eq
+  HARNESS aws_hash_callback_c_str_eq_harness.c
+  LINK byte_buf.ir string.ir common.ir hash_table.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(hash_callback_string_destroy
+  HARNESS aws_hash_callback_string_destroy_harness.c
+  LINK byte_buf.ir string.ir hash_table.ir common.ir
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK byte_buf.ir string.ir common.ir hash_table.ir
+  SMACK_LINK byte_buf.ir string.ir common.ir hash_table.ir
+  SYMBIOTIC_LINK byte_buf.ir string.ir common.ir hash_table.ir)
+
+sea_job(hash_iter_begin
+  HARNESS aws_hash_iter_begin_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=32
+  VARS MAX_TABLE_SIZE=32
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_iter_begin_done
+  HARNESS aws_hash_iter_begin_done_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=32
+  VARS MAX_TABLE_SIZE=32
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_iter_next
+  HARNESS aws_hash_iter_next_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=8
+  VARS MAX_TABLE_SIZE=8
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_iter_done
+  HARNESS aws_hash_iter_done_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=SIZE_MAX
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_iter_delete
+  HARNESS aws_hash_iter_delete_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  ENGINES fuzz smack symbiotic
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_eq
+  HARNESS aws_hash_table_eq_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=8
+  VARS MAX_TABLE_SIZE=8
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  KLEE_DEFINES MAX_TABLE_SIZE=2
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_get_entry_count
+  HARNESS aws_hash_table_get_entry_count_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_move
+  HARNESS aws_hash_table_move_harness.c
+  LINK hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_swap
+  HARNESS aws_hash_table_swap_harness.c
+  LINK hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_clean_up
+  HARNESS aws_hash_table_clean_up_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=8
+  VARS MAX_TABLE_SIZE=8 MEMCPY_UNROLL_BND=256
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_clear
+  HARNESS aws_hash_table_clear_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=8
+  VARS MAX_TABLE_SIZE=8 MEMCPY_UNROLL_BND=256
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_create
+  HARNESS aws_hash_table_create_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE update_template_size_override.ir safe_eq_check_override.ir hash_for_override.ir emplace_item_override.ir expand_table_override.ir hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=4
+  VARS MAX_TABLE_SIZE=4 UNROLL_BOUND=8
+  ENGINES fuzz smack symbiotic
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_foreach
+  HARNESS aws_hash_table_foreach_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE aws_hash_iter_overrides.ir hash_table_state_is_valid_ignore_entry_count_override.ir
+  DEFINES MAX_TABLE_SIZE=16
+  VARS MAX_TABLE_SIZE=16 UNROLL_BOUND=17
+  ENGINES fuzz smack symbiotic
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_find
+  HARNESS aws_hash_table_find_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE safe_eq_check_override.ir hash_for_override.ir hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=8
+  VARS MAX_TABLE_SIZE=8
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_init_bounded
+  HARNESS aws_hash_table_init_bounded_harness.c
+  LINK hash_table.opt.ir
+  OVERRIDE update_template_size_override.ir hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=8
+  VARS MAX_TABLE_SIZE=8 MEMCPY_UNROLL_BND=512
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  SMACK_LINK common.ir hash_table.ir
+  SMACK_FLAGS --float
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_init_unbounded
+  HARNESS aws_hash_table_init_unbounded_harness.c
+  LINK hash_table.opt.ir
+  OVERRIDE update_template_size_override.ir hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=8
+  VARS MAX_TABLE_SIZE=8
+  ENGINES klee smack symbiotic
+  KLEE_LINK common.ir hash_table.ir
+  SMACK_LINK common.ir hash_table.ir
+  SMACK_FLAGS --float
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_put
+  HARNESS aws_hash_table_put_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE update_template_size_override.ir safe_eq_check_override.ir hash_for_override.ir emplace_item_override.ir expand_table_override.ir hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=4
+  VARS MAX_TABLE_SIZE=4 UNROLL_BOUND=8
+  ENGINES fuzz smack symbiotic
+  SMACK_LINK common.ir hash_table.ir
+  SMACK_FLAGS --float
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_remove
+  HARNESS aws_hash_table_remove_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE safe_eq_check_override.ir hash_for_override.ir hash_table_state_is_valid_override.ir
+  ENGINES fuzz smack symbiotic
+  SMACK_LINK common.ir hash_table.ir
+  SMACK_FLAGS --float
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(linked_list_back
+  HARNESS aws_linked_list_back_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(linked_list_begin
+  HARNESS aws_linked_list_begin_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+# add head and tail to list size.
+# We will use our own function for is_valid check hence AWS_DEEP_CHECK is off
+sea_job(linked_list_end
+  HARNESS aws_linked_list_end_harness.c
+  DEFINES SEA_DEEP_CHECKS=0
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(linked_list_front
+  HARNESS aws_linked_list_front_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+# add head and tail to list size.
+# We will use our own function for is_valid check hence AWS_DEEP_CHECK is off
+sea_job(linked_list_init
+  HARNESS aws_linked_list_init_harness.c
+  DEFINES SEA_DEEP_CHECKS=0
+  ENGINES klee fuzz smack symbiotic)
+
+# add head and tail to list size.
+sea_job(linked_list_remove
+  HARNESS aws_linked_list_remove_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+# add head and tail to list size.
+# We will use our own function for is_valid check hence AWS_DEEP_CHECK is off
+sea_job(linked_list_pop_back
+  HARNESS aws_linked_list_pop_back_harness.c
+  DEFINES AWS_DEEP_CHECKS=0
+  VARS UNROLL_BOUND=${MAX_LINKED_LIST_ITEM_ALLOCATION_SIZE}+2
+  ENGINES klee fuzz smack symbiotic)
+
+# add head and tail to list size.
+# We will use our own function for is_valid check hence AWS_DEEP_CHECK is off
+sea_job(linked_list_pop_front
+  HARNESS aws_linked_list_pop_front_harness.c
+  DEFINES AWS_DEEP_CHECKS=0
+  VARS UNROLL_BOUND=${MAX_LINKED_LIST_ITEM_ALLOCATION_SIZE}+2
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(linked_list_prev
+  HARNESS aws_linked_list_prev_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(linked_list_next
+  HARNESS aws_linked_list_next_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(linked_list_node_reset
+  HARNESS aws_linked_list_node_reset_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+# add head and tail to list size.
+sea_job(linked_list_push_back
+  HARNESS aws_linked_list_push_back_harness.c
+  SHARD LIST_LEN 3
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(linked_list_push_front
+  HARNESS aws_linked_list_push_front_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+# add head and tail to list size.
+sea_job(linked_list_swap_contents
+  HARNESS aws_linked_list_swap_contents_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(linked_list_insert_after
+  HARNESS aws_linked_list_insert_after_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(linked_list_insert_before
+  HARNESS aws_linked_list_insert_before_harness.c
+  ENGINES klee fuzz smack symbiotic)
+
+# add head and tail to list size.
+# We will use our own function for is_valid check hence AWS_DEEP_CHECK is off
+sea_job(linked_list_rbegin
+  HARNESS aws_linked_list_rbegin_harness.c
+  DEFINES SEA_DEEP_CHECKS=0
+  ENGINES klee fuzz smack symbiotic)
+
+# add head and tail to list size.
+# We will use our own function for is_valid check hence AWS_DEEP_CHECK is off
+sea_job(linked_list_rend
+  HARNESS aws_linked_list_rend_harness.c
+  DEFINES SEA_DEEP_CHECKS=0
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(string_bytes
+  HARNESS aws_string_bytes_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(string_compare
+  HARNESS aws_string_compare_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic
+  SMACK_FLAGS --strings)
+
+sea_job(string_eq
+  HARNESS aws_string_eq_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic
+  SMACK_FLAGS --strings)
+
+sea_job(string_eq_byte_buf
+  HARNESS aws_string_eq_byte_buf_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic
+  SMACK_FLAGS --strings)
+
+sea_job(string_eq_byte_buf_ignore_case
+  HARNESS aws_string_eq_byte_buf_ignore_case_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(string_eq_byte_cursor
+  HARNESS aws_string_eq_byte_cursor_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic
+  SMACK_FLAGS --strings)
+
+sea_job(string_eq_byte_cursor_ignore_case
+  HARNESS aws_string_eq_byte_cursor_ignore_case_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(string_eq_c_str
+  HARNESS aws_string_eq_c_str_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(string_eq_c_str_ignore_case
+  HARNESS aws_string_eq_c_str_ignore_case_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(string_eq_ignore_case
+  HARNESS aws_string_eq_ignore_case_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(string_new_from_array
+  HARNESS aws_string_new_from_array_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic
+  FUZZ_SOURCES ${AWS_C_COMMON_ROOT}/source/common.c aws_string_new_from_array_harness.c)
+
+sea_job(string_new_from_c_str
+  HARNESS aws_string_new_from_c_str_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(string_new_from_string
+  HARNESS aws_string_new_from_string_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(string_destroy
+  HARNESS aws_string_destroy_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic)
+
+# requires inline asm support
+sea_job(string_destroy_secure
+  HARNESS aws_string_destroy_secure_harness.c
+  LINK byte_buf.ir string.ir common.ir
+  ENGINES klee fuzz smack symbiotic
+  FUZZ_WILL_FAIL)
+
+sea_job(priority_queue_size
+  HARNESS aws_priority_queue_size_harness.c
+  LINK array_list.ir priority_queue.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(priority_queue_capacity
+  HARNESS aws_priority_queue_capacity_harness.c
+  LINK array_list.ir priority_queue.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(priority_queue_top
+  HARNESS aws_priority_queue_top_harness.c
+  LINK array_list.ir priority_queue.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(priority_queue_init_static
+  HARNESS aws_priority_queue_init_static_harness.c
+  LINK array_list.ir priority_queue.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(priority_queue_init_dynamic
+  HARNESS aws_priority_queue_init_dynamic_harness.c
+  LINK array_list.ir priority_queue.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(priority_queue_clean_up
+  HARNESS aws_priority_queue_clean_up_harness.c
+  LINK array_list.ir priority_queue.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(ring_buffer_clean_up
+  HARNESS aws_ring_buffer_clean_up_harness.c
+  LINK byte_buf.ir ring_buffer.ir
+  ENGINES klee fuzz smack symbiotic
+  SYMBIOTIC_FLAGS --optimize=O2)
+
+sea_job(ring_buffer_init
+  HARNESS aws_ring_buffer_init_harness.c
+  LINK ring_buffer.ir
+  ENGINES klee fuzz smack symbiotic
+  KLEE_LINK byte_buf.ir ring_buffer.ir
+  SMACK_LINK byte_buf.ir ring_buffer.ir
+  SYMBIOTIC_LINK byte_buf.ir ring_buffer.ir
+  SYMBIOTIC_FLAGS --optimize=O2)
+
+sea_job(priority_queue_s_swap
+  BLEEDING_EDGE
+  HARNESS aws_priority_queue_s_swap_harness.c
+  LINK array_list.ir priority_queue.opt.ir
+  ENGINES klee smack symbiotic)
+
+sea_job(priority_queue_s_sift_up
+  BLEEDING_EDGE
+  HARNESS aws_priority_queue_s_sift_up_harness.c
+  LINK array_list.ir priority_queue.opt.ir
+  ENGINES klee smack symbiotic)
+
+sea_job(priority_queue_s_sift_down
+  BLEEDING_EDGE
+  HARNESS aws_priority_queue_s_sift_down_harness.c
+  LINK array_list.ir priority_queue.opt.ir
+  ENGINES klee smack symbiotic)
+
+sea_job(priority_queue_s_sift_either
+  BLEEDING_EDGE
+  HARNESS aws_priority_queue_s_sift_either_harness.c
+  LINK array_list.ir priority_queue.opt.ir
+  ENGINES klee smack symbiotic)
+
+sea_job(priority_queue_s_remove_node
+  BLEEDING_EDGE
+  HARNESS aws_priority_queue_s_remove_node_harness.c
+  LINK array_list.ir priority_queue.opt.ir
+  OVERRIDE sift_either_override.ir
+  ENGINES klee smack symbiotic
+  KLEE_LINK array_list.ir priority_queue.ir)
+
+sea_job(priority_queue_remove
+  BLEEDING_EDGE
+  HARNESS aws_priority_queue_remove_harness.c
+  LINK array_list.ir priority_queue.opt.ir
+  OVERRIDE remove_node_override.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(priority_queue_pop
+  BLEEDING_EDGE
+  HARNESS aws_priority_queue_pop_harness.c
+  LINK array_list.ir priority_queue.opt.ir
+  OVERRIDE remove_node_override.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(priority_queue_push
+  BLEEDING_EDGE
+  HARNESS aws_priority_queue_push_harness.c
+  LINK array_list.ir priority_queue.opt.ir
+  OVERRIDE sift_up_override.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(priority_queue_push_ref
+  BLEEDING_EDGE
+  HARNESS aws_priority_queue_push_ref_harness.c
+  LINK array_list.ir priority_queue.opt.ir
+  OVERRIDE sift_up_override.ir
+  ENGINES klee fuzz smack symbiotic)
+
+sea_job(ring_buffer_release
+  BLEEDING_EDGE
+  HARNESS aws_ring_buffer_release_harness.c
+  LINK byte_buf.ir ring_buffer.ir
+  ENGINES klee fuzz smack symbiotic
+  SYMBIOTIC_FLAGS --optimize=O2)
+
+sea_job(ring_buffer_acquire
+  BLEEDING_EDGE
+  HARNESS aws_ring_buffer_acquire_harness.c
+  LINK byte_buf.ir ring_buffer.ir
+  ENGINES klee fuzz smack symbiotic
+  SYMBIOTIC_FLAGS --optimize=O2)
+
+sea_job(ring_buffer_buf_belongs_to_pool
+  BLEEDING_EDGE
+  HARNESS aws_ring_buffer_buf_belongs_to_pool_harness.c
+  LINK byte_buf.ir ring_buffer.ir
+  ENGINES klee smack symbiotic
+  SYMBIOTIC_FLAGS --optimize=O2)
+
+sea_job(ring_buffer_acquire_up_to
+  BLEEDING_EDGE
+  HARNESS aws_ring_buffer_acquire_up_to_harness.c
+  LINK byte_buf.ir ring_buffer.ir
+  ENGINES klee fuzz smack symbiotic
+  SYMBIOTIC_FLAGS --optimize=O2)
+
+sea_job(hash_table_foreach_deep_loose
+  BLEEDING_EDGE
+  HARNESS aws_hash_table_foreach_deep_loose_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_ignore_entry_count_override.ir
+  DEFINES MAX_TABLE_SIZE=2
+  VARS MAX_TABLE_SIZE=2 UNROLL_BOUND=4
+  ENGINES smack symbiotic
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
+
+sea_job(hash_table_foreach_deep_precise
+  BLEEDING_EDGE
+  HARNESS aws_hash_table_foreach_deep_precise_harness.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=2
+  VARS MAX_TABLE_SIZE=2 UNROLL_BOUND=4
+  ENGINES smack symbiotic
+  SMACK_LINK common.ir hash_table.ir
+  SYMBIOTIC_LINK common.ir hash_table.ir)
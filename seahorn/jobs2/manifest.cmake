@@ -0,0 +1,304 @@
+# Variants of jobs that check that parameters are left unmodified with
+# SeaHorn memory tracking, expanded by sea_job()
+
+sea_job(array_eq2
+  HARNESS aws_array_eq_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(array_eq_c_str2
+  HARNESS aws_array_eq_c_str_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(array_eq_c_str_ignore_case2
+  HARNESS aws_array_eq_c_str_ignore_case_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(array_eq_ignore_case2
+  HARNESS aws_array_eq_ignore_case_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(array_list_back2
+  HARNESS aws_array_list_back_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_capacity2
+  HARNESS aws_array_list_capacity_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_ensure_capacity2
+  HARNESS aws_array_list_ensure_capacity_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_front2
+  HARNESS aws_array_list_front_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_get_at2
+  HARNESS aws_array_list_get_at_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_get_at_ptr2
+  HARNESS aws_array_list_get_at_ptr_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_init_static2
+  HARNESS aws_array_list_init_static_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_length2
+  HARNESS aws_array_list_length_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_pop_back2
+  HARNESS aws_array_list_pop_back_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_pop_front2
+  HARNESS aws_array_list_pop_front_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_push_back2
+  HARNESS aws_array_list_push_back_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_set_at2
+  HARNESS aws_array_list_set_at_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_shrink_to_fit2
+  HARNESS aws_array_list_shrink_to_fit_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_sort2
+  HARNESS aws_array_list_sort_harness2.c
+  LINK array_list.ir)
+
+sea_job(byte_buf_eq2
+  HARNESS aws_byte_buf_eq_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_advance2
+  HARNESS aws_byte_buf_advance_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_append2
+  HARNESS aws_byte_buf_append_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_append_dynamic2
+  HARNESS aws_byte_buf_append_dynamic_harness2.c
+  LINK byte_buf.ir
+  DEFINES __SEA_AWS_ALLOCATOR__)
+
+sea_job(byte_buf_append_with_lookup2
+  HARNESS aws_byte_buf_append_with_lookup_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_cat2
+  HARNESS aws_byte_buf_cat_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_eq_c_str2
+  HARNESS aws_byte_buf_eq_c_str_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_eq_c_str_ignore_case2
+  HARNESS aws_byte_buf_eq_c_str_ignore_case_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_eq_ignore_case2
+  HARNESS aws_byte_buf_eq_ignore_case_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_init_copy2
+  HARNESS aws_byte_buf_init_copy_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(array_list_clear2
+  HARNESS aws_array_list_clear_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_erase2
+  HARNESS aws_array_list_erase_harness2.c
+  LINK array_list.ir)
+
+sea_job(array_list_pop_front_n2
+  HARNESS aws_array_list_pop_front_n_harness2.c
+  LINK array_list.ir)
+
+sea_job(byte_buf_write2
+  HARNESS aws_byte_buf_write_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_write_be162
+  HARNESS aws_byte_buf_write_be16_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_write_be322
+  HARNESS aws_byte_buf_write_be32_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_write_be642
+  HARNESS aws_byte_buf_write_be64_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_write_from_whole_buffer2
+  HARNESS aws_byte_buf_write_from_whole_buffer_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_write_from_whole_cursor2
+  HARNESS aws_byte_buf_write_from_whole_cursor_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_buf_write_from_whole_string2
+  HARNESS aws_byte_buf_write_from_whole_string_harness2.c
+  LINK string.ir byte_buf.ir)
+
+sea_job(byte_buf_write_u82
+  HARNESS aws_byte_buf_write_u8_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_advance2
+  HARNESS aws_byte_cursor_advance_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_read2
+  HARNESS aws_byte_cursor_read_harness2.c
+  LINK byte_buf.ir
+  OVERRIDE byte_cursor_advance_nospec_override.ir)
+
+sea_job(byte_cursor_read_u8_2
+  HARNESS aws_byte_cursor_read_u8_harness2.c
+  LINK byte_buf.ir
+  OVERRIDE byte_cursor_advance_nospec_override.ir)
+
+sea_job(byte_cursor_eq2
+  HARNESS aws_byte_cursor_eq_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_from_buf2
+  HARNESS aws_byte_cursor_from_buf_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_read_be32_2
+  HARNESS aws_byte_cursor_read_be32_harness2.c
+  LINK byte_buf.ir
+  OVERRIDE byte_cursor_advance_nospec_override.ir)
+
+sea_job(byte_cursor_eq_byte_buf_ignore_case2
+  HARNESS aws_byte_cursor_eq_byte_buf_ignore_case_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_eq_c_str2
+  HARNESS aws_byte_cursor_eq_c_str_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_read_be64_2
+  HARNESS aws_byte_cursor_read_be64_harness2.c
+  LINK byte_buf.ir
+  OVERRIDE byte_cursor_advance_nospec_override.ir)
+
+sea_job(byte_cursor_compare_lookup2
+  HARNESS aws_byte_cursor_compare_lookup_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_trim_pred2
+  HARNESS aws_byte_cursor_trim_pred_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_left_trim_pred2
+  HARNESS aws_byte_cursor_left_trim_pred_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_advance_nospec2
+  HARNESS aws_byte_cursor_advance_nospec_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_read_be16_2
+  HARNESS aws_byte_cursor_read_be16_harness2.c
+  LINK byte_buf.ir
+  OVERRIDE byte_cursor_advance_nospec_override.ir)
+
+sea_job(byte_cursor_eq_c_str_ignore_case2
+  HARNESS aws_byte_cursor_eq_c_str_ignore_case_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_eq_byte_buf2
+  HARNESS aws_byte_cursor_eq_byte_buf_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_eq_ignore_case2
+  HARNESS aws_byte_cursor_eq_ignore_case_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_right_trim_pred2
+  HARNESS aws_byte_cursor_right_trim_pred_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_read_and_fill_buffer2
+  HARNESS aws_byte_cursor_read_and_fill_buffer_harness2.c
+  LINK byte_buf.ir
+  OVERRIDE byte_cursor_advance_nospec_override.ir)
+
+sea_job(byte_cursor_satisfies_pred2
+  HARNESS aws_byte_cursor_satisfies_pred_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(byte_cursor_compare_lexical2
+  HARNESS aws_byte_cursor_compare_lexical_harness2.c
+  LINK byte_buf.ir)
+
+sea_job(hash_iter_done2
+  HARNESS aws_hash_iter_done_harness2.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=SIZE_MAX)
+
+sea_job(hash_table_get_entry_count2
+  HARNESS aws_hash_table_get_entry_count_harness2.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir)
+
+sea_job(hash_iter_begin2
+  HARNESS aws_hash_iter_begin_harness2.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=32
+  VARS MAX_TABLE_SIZE=32)
+
+sea_job(hash_table_find2
+  HARNESS aws_hash_table_find_harness2.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE safe_eq_check_override.ir hash_for_override.ir hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=8
+  VARS MAX_TABLE_SIZE=8)
+
+sea_job(hash_iter_next2
+  HARNESS aws_hash_iter_next_harness2.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=8
+  VARS MAX_TABLE_SIZE=8)
+
+sea_job(hash_iter_begin_done2
+  HARNESS aws_hash_iter_begin_done_harness2.c
+  LINK common.ir hash_table.opt.ir
+  OVERRIDE hash_table_state_is_valid_override.ir
+  DEFINES MAX_TABLE_SIZE=32
+  VARS MAX_TABLE_SIZE=32)
+
+sea_job(ring_buffer_acquire2
+  HARNESS aws_ring_buffer_acquire_harness2.c
+  LINK byte_buf.ir ring_buffer.ir)
+
+sea_job(ring_buffer_release2
+  HARNESS aws_ring_buffer_release_harness2.c
+  LINK byte_buf.ir ring_buffer.ir)
+
+sea_job(ring_buffer_buf_belongs_to_pool2
+  HARNESS aws_ring_buffer_buf_belongs_to_pool_harness2.c
+  LINK byte_buf.ir ring_buffer.ir)
+
+sea_job(ring_buffer_acquire_up_to2
+  HARNESS aws_ring_buffer_acquire_up_to_harness2.c
+  LINK byte_buf.ir ring_buffer.ir)
@@ -0,0 +1,11 @@
+# Verification jobs expected to find a bug, expanded by sea_job()
+
+# This proof is sat because there is a bug in aws-c-commons
+# aws_mem_realloc can be failed by calling mem_cpy
+# Since there are no preconditions for the void **ptr and size oldsize.
+# The *ptr could be a NULL and the oldsize > 0.
+sea_job(mem_realloc_unsafe
+  SAT
+  NO_PROOF_LIB
+  HARNESS ${SEA_LIB}/bcmp.c ${SEA_LIB}/proof_allocators.c ${SEA_LIB}/sea_allocators.c aws_mem_realloc_unsafe_harness.c
+  LINK allocator.ir sea_bounds.ir)
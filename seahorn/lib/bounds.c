@@ -1,5 +1,6 @@
 #include <bounds.h>
 #include <config.h>
+#include <stdint.h>
 
 size_t sea_max_buffer_size(void) { return MAX_BUFFER_SIZE; }
 size_t sea_max_string_len(void) { return MAX_STRING_LEN; }
@@ -8,4 +9,7 @@ size_t sea_max_array_list_item_size(void) { return MAX_ITEM_SIZE; }
 size_t sea_max_array_list_len(void) { return MAX_INITIAL_ITEM_ALLOCATION; }
 size_t fuzz_max_array_list_len(void) { return MAX_INITIAL_ITEM_ALLOCATION_FUZZ; }
 size_t fuzz_max_array_list_item_size(void) { return MAX_ITEM_SIZE_FUZZ; }
-size_t sea_max_table_size(void) { return MAX_TABLE_SIZE; }
\ No newline at end of file
+size_t sea_max_table_size(void) { return MAX_TABLE_SIZE; }
+/* no shard, overridden by the shards of a sharded job */
+size_t sea_shard_lo(int var) { return 0; }
+size_t sea_shard_hi(int var) { return SIZE_MAX; }
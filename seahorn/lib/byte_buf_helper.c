@@ -20,6 +20,7 @@ void initialize_byte_buf(struct aws_byte_buf *const buf) {
     size_t cap = nd_size_t();
     assume(len <= cap);
     assume(cap <= sea_max_buffer_size());
+    assume(sea_in_shard(SEA_SHARD_BUF_CAPACITY, cap));
 
     buf->len = len;
     buf->capacity = cap;
@@ -3,6 +3,7 @@
 
 #include <seahorn/seahorn.h>
 
+#include <bounds.h>
 #include <hash_table_helper.h>
 #include <proof_allocators.h>
 
@@ -13,6 +14,7 @@ void initialize_bounded_aws_hash_table(struct aws_hash_table *map,
                                        size_t max_table_entries) {
   size_t num_entries = nd_size_t();
   assume(num_entries <= max_table_entries);
+  assume(sea_in_shard(SEA_SHARD_TABLE_ENTRIES, num_entries));
   assume(aws_is_power_of_two(num_entries));
 
   size_t required_bytes = nd_size_t();
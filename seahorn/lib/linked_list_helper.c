@@ -1,3 +1,4 @@
+#include <bounds.h>
 #include <linked_list_helper.h>
 #include <nondet.h>
 #include <proof_allocators.h>
@@ -39,6 +40,7 @@ void sea_nd_init_aws_linked_list_from_head(struct aws_linked_list *list,
   list->tail.next = NULL;
 
   size_t nd_len = nd_size_t();
+  assume(sea_in_shard(SEA_SHARD_LIST_LEN, nd_len));
   *length = nd_len;
   if (nd_len <= 2) {
     init_short_aws_linked_list(list, nd_len);
@@ -62,6 +64,7 @@ void sea_nd_init_aws_linked_list_from_tail(struct aws_linked_list *list,
   list->tail.next = NULL;
 
   size_t nd_len = nd_size_t();
+  assume(sea_in_shard(SEA_SHARD_LIST_LEN, nd_len));
   *length = nd_len;
   if (nd_len <= 2) {
     init_short_aws_linked_list(list, nd_len);
@@ -85,6 +88,7 @@ void sea_nd_init_aws_linked_list(struct aws_linked_list *list,
   list->tail.next = NULL;
 
   size_t nd_len = nd_size_t();
+  assume(sea_in_shard(SEA_SHARD_LIST_LEN, nd_len));
   *length = nd_len;
   if (nd_len <= 2) {
     init_short_aws_linked_list(list, nd_len);